@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <sys/time.h>
+#include <string.h>
+#include <assert.h>
+
+#include "randomizer.h"
+#include "word_library.h"
+
+// --------------------------------------------------
+// elapsed_microseconds
+// --------------------------------------------------
+double elapsed_microseconds(struct timeval* start) {
+
+	struct timeval now;
+	gettimeofday(&now, NULL);
+
+	return (now.tv_sec - start->tv_sec) * 1e6 + (now.tv_usec - start->tv_usec);
+}
+
+// --------------------------------------------------
+// time_multiply
+// --------------------------------------------------
+//   returns the average time (in microseconds) of one
+//   "word_op_multiply" call on two operands of "limbs"
+//   limbs each, with the given thresholds in effect.
+// --------------------------------------------------
+double time_multiply(unsigned int limbs,
+					 unsigned int karatsuba_threshold,
+					 unsigned int toom3_threshold) {
+
+	const unsigned short length = limbs * LIMB_BITS;
+
+	word_pointer A = create_word(length),
+	             B = create_word(length),
+	             AB = create_word(2 * length);
+
+	word_randomize(A);
+	word_randomize(B);
+
+	word_karatsuba_threshold = karatsuba_threshold;
+	word_toom3_threshold = toom3_threshold;
+
+	// repeat the multiplication for at least 20 milliseconds.
+	unsigned int repetitions = 0;
+	struct timeval start;
+	gettimeofday(&start, NULL);
+
+	do {
+		for (unsigned int i = 0; i < 16; ++i)
+			word_op_multiply(AB, A, B);
+		repetitions += 16;
+	} while (elapsed_microseconds(&start) < 20000.0);
+
+	const double average = elapsed_microseconds(&start) / repetitions;
+
+	word_deallocate(AB);
+	word_deallocate(B);
+	word_deallocate(A);
+
+	return average;
+}
+
+int main (int argc, const char * argv[]) {
+
+	if (-1 == initialize_randomizer()) return -1;
+
+	// the largest operand size to try, in limbs (a word
+	// can't be wider than 65535 bits, or 1023 limbs).
+	unsigned int maximum_limbs = 160;
+	if (argc > 1)
+		maximum_limbs = (unsigned int) atoi(argv[1]);
+
+	if (maximum_limbs < 4 || maximum_limbs > 511) {
+		perror("The operand size should be between 4 and 511 limbs.");
+		return 0;
+	}
+
+	const unsigned int disabled = ~0u;
+	const unsigned int default_karatsuba_threshold = word_karatsuba_threshold,
+	                   default_toom3_threshold = word_toom3_threshold;
+
+	printf(
+		"-----------------------------------------------------------------------------\n"
+		"                WORD_OP_MULTIPLY CROSSOVER BENCHMARK                         \n"
+		"-----------------------------------------------------------------------------\n"
+		" times are in microseconds per multiplication of two n-limb operands, where\n"
+		" each method is only applied at the top level (smaller products use the best\n"
+		" method found so far).\n"
+		"-----------------------------------------------------------------------------\n"
+		"   n  (bits)   schoolbook   karatsuba      toom-3\n");
+
+	// the crossover is taken as the smallest size from which
+	// the faster method keeps winning for three sizes in a row.
+	unsigned int karatsuba_crossover = 0, toom3_crossover = 0;
+	unsigned int karatsuba_wins = 0, toom3_wins = 0;
+	unsigned int karatsuba_first_win = 0, toom3_first_win = 0;
+
+	for (unsigned int n = 4; n <= maximum_limbs; n += (n < 32 ? 1 : (n < 128 ? 4 : 16))) {
+
+		const unsigned int karatsuba_below = (karatsuba_crossover ? karatsuba_crossover : disabled);
+
+		const double schoolbook = time_multiply(n, disabled, disabled);
+		const double karatsuba = time_multiply(n, n, disabled);
+		const double toom3 = time_multiply(n, (karatsuba_below < n ? karatsuba_below : n), n);
+
+		printf(" %4u  (%5u)  %10.2f  %10.2f  %10.2f\n",
+			   n, n * LIMB_BITS, schoolbook, karatsuba, toom3);
+
+		if (0 == karatsuba_crossover) {
+			karatsuba_wins = (karatsuba < schoolbook ? karatsuba_wins + 1 : 0);
+			if (1 == karatsuba_wins)
+				karatsuba_first_win = n;
+			if (3 == karatsuba_wins)
+				karatsuba_crossover = karatsuba_first_win;
+		}
+
+		if (0 == toom3_crossover && 0 != karatsuba_crossover) {
+			toom3_wins = (toom3 < karatsuba ? toom3_wins + 1 : 0);
+			if (1 == toom3_wins)
+				toom3_first_win = n;
+			if (3 == toom3_wins)
+				toom3_crossover = toom3_first_win;
+		}
+	}
+
+	printf("-----------------------------------------------------------------------------\n");
+
+	if (karatsuba_crossover)
+		printf(" Karatsuba beats the schoolbook method from about %u limbs.\n", karatsuba_crossover);
+	else printf(" Karatsuba never beats the schoolbook method up to %u limbs.\n", maximum_limbs);
+
+	if (toom3_crossover)
+		printf(" Toom-3 beats Karatsuba from about %u limbs.\n", toom3_crossover);
+	else printf(" Toom-3 never beats Karatsuba up to %u limbs.\n", maximum_limbs);
+
+	printf(" (defaults: word_karatsuba_threshold = %u, word_toom3_threshold = %u)\n",
+		   default_karatsuba_threshold, default_toom3_threshold);
+
+	return 0;
+}
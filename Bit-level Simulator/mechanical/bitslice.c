@@ -0,0 +1,569 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <sys/time.h>
+#include <string.h>
+#include <assert.h>
+
+#include "randomizer.h"
+#include "word_library.h"
+#include "bitslice_library.h"
+#include "parameters_library.h"
+
+// the bit-sliced batch simulator: runs the practical and the
+// theoretical versions of the algorithm of "main.c" on SLICE_LANES
+// random problems at once, with every register of "main.c" turned
+// into a slice word, and reports the lanes that failed.
+
+// --------------------------------------------------
+// elapsed_microseconds
+// --------------------------------------------------
+double elapsed_microseconds(struct timeval* start) {
+
+	struct timeval now;
+	gettimeofday(&now, NULL);
+
+	return (now.tv_sec - start->tv_sec) * 1e6 + (now.tv_usec - start->tv_usec);
+}
+
+int main (int argc, const char * argv[]) {
+
+	if (-1 == initialize_randomizer()) return -1;
+
+	// the options, which come first and override the built-in
+	// configuration in the order they are given, as in "main.c"
+	// (-c <file>, -s <key>=<value> and -t <file>, see
+	// "system_parameters_option").
+	int options_end = 1;
+	while (options_end + 1 < argc && '-' == argv[options_end][0])
+		options_end += 2;
+
+	// the number of batches of SLICE_LANES problems to run.
+	unsigned int batches = 16;
+	if (argc > options_end)
+		batches = (unsigned int) atoi(argv[options_end]);
+
+	struct system_parameters parameters;
+	if (-1 == system_parameters_builtin(&parameters))
+		return 0;
+
+	for (int option = 1; option < options_end; option += 2) {
+		char result = system_parameters_option(&parameters, argv[option], argv[option + 1]);
+
+		if (1 == result) {
+			fprintf(stderr, "Unknown option \"%s\" (use -c, -s or -t).\n", argv[option]);
+			result = -1;
+		}
+
+		if (-1 == result) {
+			system_parameters_deallocate(&parameters);
+			return 0;
+		}
+	}
+
+	if (-1 == system_parameters_derive(&parameters)) {
+		system_parameters_deallocate(&parameters);
+		return 0;
+	}
+
+	// the digits are selected as in the built-in configuration
+	// (see "algorithm_first_digit" in parameters_library.h).
+	if (FIRST_DIGIT_SELECTOR != parameters.algorithm_first_digit ||
+		!parameters.algorithm_initialroot || !parameters.algorithm_loose_bit) {
+		perror("The bit-sliced simulator needs first_digit = 0, initialroot = 1 and loose_bit = 1.");
+		system_parameters_deallocate(&parameters);
+		return 0;
+	}
+
+	// the system parameters, under the names used by "main.c"
+	const unsigned short
+		algorithm_m = parameters.algorithm_m,
+		algorithm_n = parameters.algorithm_n,
+		algorithm_Z = parameters.algorithm_Z;
+	const unsigned short
+		algorithm_alpha = parameters.algorithm_alpha,
+		algorithm_beta = parameters.algorithm_beta,
+		algorithm_ns = parameters.algorithm_ns,
+		algorithm_np = parameters.algorithm_np,
+		algorithm_np_fractional = parameters.algorithm_np_fractional,
+		algorithm_table_unsigned = parameters.algorithm_table_unsigned;
+	const unsigned char algorithm_residual_carrysave = parameters.algorithm_residual_carrysave,
+		algorithm_multiplier_signed = parameters.algorithm_multiplier_signed;
+
+	const unsigned short* SRT_table_dimensions = parameters.SRT_table_dimensions;
+	const unsigned short SRT_table_p0 = parameters.SRT_table_p0;
+	const unsigned short (*SRT_table_mappings)[3] = parameters.SRT_table_mappings;
+	const unsigned short SRT_table_mappings_count = parameters.SRT_table_mappings_count;
+
+	const unsigned short
+		iterations = parameters.iterations,
+		delta = parameters.delta,
+		mb = parameters.mb,
+		processor_size = parameters.processor_size;
+	const unsigned short
+		register_S_size = parameters.register_S_size,
+		register_A_size = parameters.register_A_size,
+		register_W_size = parameters.register_W_size;
+
+	printf(
+		"-----------------------------------------------------------------------------\n"
+		"           ORWA-AMIN MULTIPLICATIVE SQUARE-ROOT ALGORITHM SIMULATOR          \n"
+		"-----------------------------------------------------------------------------\n"
+		" TYPE OF SIMULATION: Bit-sliced batch verification (%d problems per pass)\n"
+		"-----------------------------------------------------------------------------\n",
+		SLICE_LANES);
+
+	printf("System parameters:\n"
+		   " - m: %d bits\t\t→ RADIX = %d\n - n: %d iterations\n - Z: %d bits\n"
+		   "\nSystem variables:\n"
+		   " - size of operands:    %d bits\n"
+		   " - iterations:			%d iteration(s)\n\n",
+		   algorithm_m, 1 << algorithm_m, algorithm_n, algorithm_Z,
+		   processor_size, iterations);
+
+	// -------------------------------------
+	// the words of a single problem, which
+	// are generated a lane at a time.
+	// -------------------------------------
+	word_pointer random_seed1 = create_word(processor_size >> 1);
+	word_pointer random_seed2 = create_word(processor_size >> 1);
+	word_pointer A = create_word(processor_size);
+	word_pointer B = create_word(processor_size);
+	word_pointer S = create_word(processor_size);
+	word_pointer S_prime = create_word(algorithm_Z + processor_size + mb);
+
+	const unsigned int B_digit_capacity = (processor_size + algorithm_m - 1) / algorithm_m + 1;
+	int B_digits[B_digit_capacity];
+
+	// the A and B operands of every lane, kept to report the
+	// failing problems.
+	word_pointer lane_A[SLICE_LANES], lane_B[SLICE_LANES];
+	for (unsigned int lane = 0; lane < SLICE_LANES; ++lane) {
+		lane_A[lane] = create_word(processor_size);
+		lane_B[lane] = create_word(processor_size);
+	}
+
+	// -------------------------------------
+	// the hardware registers of "main.c",
+	// a slice word each.
+	// -------------------------------------
+	slice_pointer register_S = create_slice_word(register_S_size);
+	slice_pointer register_A = create_slice_word(register_A_size);
+	slice_pointer register_W = create_slice_word(register_W_size);
+	slice_pointer register_S_practical = create_slice_word(register_S_size);
+	slice_pointer register_S_m1 = create_slice_word(register_S_size);
+	slice_pointer register_2S = create_slice_word(register_S_size + 1);
+	slice_pointer register_2S_m1 = create_slice_word(register_S_size + 1);
+	slice_pointer register_W_practical = create_slice_word(register_W_size);
+	register_W->is_signed = 1;
+	register_W_practical->is_signed = 1;
+
+	// the carry word of the practical residual, which stays at
+	// zero unless "algorithm_residual_carrysave" is set (see
+	// "main.c").
+	slice_pointer register_W_practical_carry = create_slice_word(register_W_size);
+
+	// the delayed root S' of every lane, out of which the
+	// precomputed digits s' are read.
+	slice_pointer register_S_prime = create_slice_word(S_prime->length);
+	const unsigned int S_prime_digit_count =
+		(S_prime->length + algorithm_m - 1) / algorithm_m;
+
+	// the multiplier digits of every lane: [0] is b1, and [i] is
+	// the digit bi+1 consumed by the iteration "i".
+	slice_pointer digits_B[iterations + 1];
+	for (unsigned int i = 0; i <= iterations; ++i) {
+		digits_B[i] = create_slice_word(algorithm_m + 2);
+		digits_B[i]->is_signed = 1;
+	}
+
+	slice_pointer digit_S = create_slice_word(algorithm_m);
+	// the result digit returned by the SRT table look-up, with a
+	// sign bit and an extra bit for the on-the-fly conversion.
+	slice_pointer signed_digit = create_slice_word(algorithm_m + 2);
+	signed_digit->is_signed = 1;
+
+	// the on-the-fly conversion digits (see "main.c"), which are
+	// the least-significant bits of the digit and of the digit
+	// minus one.
+	slice_pointer onthefly_appended_digit = create_slice_word(algorithm_m);
+	slice_pointer onthefly_appended_digit_m1 = create_slice_word(algorithm_m);
+	slice_pointer onthefly_appended_digit_t2 = create_slice_word(algorithm_m + 1);
+	slice_pointer onthefly_appended_digit_t2m1 = create_slice_word(algorithm_m + 1);
+
+	slice_pointer S0s = create_slice_word(algorithm_m * (algorithm_n + 1));
+	slice_pointer S0s_theoretical = create_slice_word(register_S_size + algorithm_m + 1);
+
+	// the fields read for the table look-up, the P index being
+	// wide enough for the np + 1 bits of the sample and for
+	// "SRT_table_p0 - P", p0 being an unsigned short.
+	const unsigned int index_bits = (algorithm_np + 2 > 17 ? algorithm_np + 2 : 17);
+	slice_t P_index[index_bits], S_index[algorithm_ns - 1];
+	slice_t P_rows[SRT_table_dimensions[0]], S_columns[SRT_table_dimensions[1]];
+
+	const unsigned short partial_product_offset = algorithm_m;
+	const unsigned short linearquadratic_offset =
+		algorithm_m * (algorithm_n + 1) + 2 * algorithm_Z;
+
+	unsigned long long passed = 0, diverged = 0, overflowed = 0,
+	                   mismatched = 0, table_failures = 0;
+	unsigned int reported = 0;
+
+	struct timeval start;
+	gettimeofday(&start, NULL);
+
+	for (unsigned int batch = 0; batch < batches; ++batch) {
+
+		// -------------------------------------
+		// generate a random problem per lane
+		// (see "main.c")
+		// -------------------------------------
+		slice_clear(register_A);
+		slice_clear(register_S_prime);
+
+		for (unsigned int lane = 0; lane < SLICE_LANES; ++lane) {
+
+			word_randomize(random_seed1);
+			word_randomize(random_seed2);
+
+			word_op_multiply(A, random_seed1, random_seed1);
+			word_op_multiply(B, random_seed2, random_seed2);
+			word_op_multiply(S, random_seed1, random_seed2);
+
+			memset((void*) LIMBS(S_prime), 0, LIMB_COUNT(S_prime->length) * sizeof(uint64_t));
+			word_op_load(S_prime, S, mb);
+
+			word_op_load(lane_A[lane], A, 0);
+			word_op_load(lane_B[lane], B, 0);
+
+			slice_load_lane(register_A, lane, A);
+			slice_load_lane(register_S_prime, lane, S_prime);
+
+			if (algorithm_multiplier_signed)
+				word_makesignedlist_into(B, algorithm_m, B_digits, B_digit_capacity);
+			else
+				word_makelist_into(B, algorithm_m, (unsigned int*) B_digits, B_digit_capacity);
+
+			for (unsigned int i = 0; i <= iterations; ++i)
+				slice_load_lane_constant(digits_B[i], lane,
+					(i + 1 <= (unsigned int) B_digits[0] ? B_digits[i + 1] : 0));
+		}
+
+		// -------------------------------------
+		// initialization step of the algorithm
+		// -------------------------------------
+		slice_clear(register_S);
+		slice_clear(register_W);
+		slice_clear(register_S_practical);
+		slice_clear(register_S_m1);
+		slice_clear(register_2S);
+		slice_clear(register_2S_m1);
+		slice_clear(register_W_practical);
+		slice_clear(register_W_practical_carry);
+
+		{
+			// {W} = {W}practical = b1×A
+			const struct slice_term initial_term = {register_A, +1, 0, digits_B[0]};
+			slice_op_shift_accumulate(register_W, 0, &initial_term, 1);
+			slice_op_carrysave_accumulate(register_W_practical, register_W_practical_carry,
+				0, &initial_term, 1);
+		}
+
+		unsigned short P_cursor =
+			(algorithm_m * algorithm_n + algorithm_Z) - algorithm_np_fractional - 1;
+
+		// the lanes that ran into the forbidden or out-of-range
+		// cells of the table.
+		slice_t table_failure = slice_fill(0);
+
+		// -------------------------------------
+		// the algorithm's loop
+		// -------------------------------------
+		for (unsigned int iteration = 1;
+			 iteration <= iterations; ++iteration) {
+
+			const int Sdot_cursor =
+				((int) iteration - 1) * algorithm_m - algorithm_Z - algorithm_ns - 1 /* loose-bit */;
+
+			// the current delayed root digit s'i (precomputed)
+			slice_clear(digit_S);
+			if (iteration <= S_prime_digit_count)
+				slice_extract_bits(SLICES(digit_S), register_S_prime,
+					(int) (algorithm_m * (S_prime_digit_count - iteration)),
+					algorithm_m, slice_fill(0));
+
+			// THE SRT TABLE LOOK-UP
+			slice_clear(signed_digit);
+			slice_t* const digit_bits = SLICES(signed_digit);
+
+			if (iteration == delta) {
+				// First-Digit Selector: digit has to be chosen from {1,2,3},
+				// that is 3 for ABC = 011 or more, 2 for ABC = 001 or more
+				// and 1 otherwise, ABC being estimated along with its sign
+				// bit and a guard bit (a negative ABC is clamped at 000,
+				// see "main.c").
+				slice_t W_sample[5];
+				slice_carrysave_estimate(W_sample, register_W_practical, register_W_practical_carry,
+					(algorithm_m * (algorithm_n + 1) + 2 * algorithm_Z) - 4, 5, slice_fill(0));
+
+				const slice_t above_two = ~W_sample[4] & (W_sample[3] | (W_sample[2] & W_sample[1]));
+				const slice_t above_zero = ~W_sample[4] & (W_sample[3] | W_sample[2] | W_sample[1]);
+
+				digit_bits[0] = above_two | ~above_zero;
+				digit_bits[1] = above_zero;
+
+			} else if (iteration > delta) {
+
+				// the loose-bit signal, the most-significant bit of Sdot,
+				// moves both samples one bit up in the lanes where it is
+				// zero (see "main.c").
+				const slice_t loose_bit_signal =
+					slice_readbit(register_S_practical, Sdot_cursor + algorithm_ns);
+
+				slice_extract_bits(S_index, register_S_practical,
+					Sdot_cursor, algorithm_ns - 1, loose_bit_signal);
+
+				// the signed P sample (estimated from the carry-save
+				// residual), sign-extended over the index.
+				slice_carrysave_estimate(P_index, register_W_practical, register_W_practical_carry,
+					P_cursor, algorithm_np + 1, loose_bit_signal);
+				for (unsigned int k = algorithm_np + 1; k < index_bits; ++k)
+					P_index[k] = P_index[algorithm_np];
+
+				// for symmetric-table implementations (a carry-save
+				// residual mirrors P through its ones' complement, see
+				// "main.c")
+				const slice_t was_inverted = (algorithm_table_unsigned ?
+											  P_index[index_bits - 1] : slice_fill(0));
+				if (algorithm_residual_carrysave) {
+					for (unsigned int k = 0; k < index_bits; ++k)
+						P_index[k] ^= was_inverted;
+				} else
+					slices_negate(P_index, index_bits, was_inverted);
+
+				// calculation of the P table index (p0 - P)
+				slices_negate(P_index, index_bits, slice_fill(1));
+				slices_add_constant(P_index, index_bits, SRT_table_p0);
+
+				// apply the custom mappings
+				for (unsigned int i = 0; i < SRT_table_mappings_count; ++i) {
+					if (iteration != SRT_table_mappings[i][2])
+						continue;
+
+					const slice_t mapped = slices_equal_constant(S_index, algorithm_ns - 1,
+						SRT_table_mappings[i][0] - 1);
+					for (unsigned int k = 0; k < (unsigned int) algorithm_ns - 1; ++k)
+						S_index[k] = (S_index[k] & ~mapped) |
+							(slice_fill(((SRT_table_mappings[i][1] - 1) >> k) & 1) & mapped);
+				}
+
+				// the rows and the columns of the table selected in
+				// every lane, at most one of each.
+				slice_t any_row = slice_fill(0), any_column = slice_fill(0);
+				for (unsigned int p = 0; p < SRT_table_dimensions[0]; ++p)
+					any_row |= (P_rows[p] = slices_equal_constant(P_index, index_bits, p));
+				for (unsigned int s = 0; s < SRT_table_dimensions[1]; ++s)
+					any_column |= (S_columns[s] = slices_equal_constant(S_index, algorithm_ns - 1, s));
+
+				// SRT table indexing problem (indices out of range).
+				table_failure |= ~(any_row & any_column);
+
+				// The actual look up, the digit of a cell is OR-ed into
+				// the lanes that select it.
+				for (unsigned int p = 0; p < SRT_table_dimensions[0]; ++p) {
+					for (unsigned int s = 0; s < SRT_table_dimensions[1]; ++s) {
+
+						const slice_t cell = P_rows[p] & S_columns[s];
+						if (!slice_any(cell))
+							continue;
+
+						const int digit = srt_table_cell(&parameters, p, s);
+						for (unsigned int k = 0; k < signed_digit->length; ++k)
+							if ((digit >> k) & 1)
+								digit_bits[k] |= cell;
+
+						// Forbidden cells of the SRT table, once the digit
+						// is negated in the inverted lanes.
+						if (digit < -algorithm_alpha || digit > +algorithm_beta)
+							table_failure |= cell & ~was_inverted;
+						if (-digit < -algorithm_alpha || -digit > +algorithm_beta)
+							table_failure |= cell & was_inverted;
+					}
+				}
+
+				// for symmetric-table implementations
+				slices_negate(digit_bits, signed_digit->length, was_inverted);
+			}
+
+			// ON-THE-FLY CONVERSION: PART 1
+			// (a negative digit, or a digit minus one, selects the
+			// minus-one copy of the result, and the appended digits
+			// are the m least-significant bits of both)
+			const slice_t onthefly_select = digit_bits[signed_digit->length - 1];
+
+			slice_t digit_m1[signed_digit->length];
+			memcpy((void*) digit_m1, (void*) digit_bits, sizeof(digit_m1));
+			slices_add_constant(digit_m1, signed_digit->length, -1);
+			const slice_t onthefly_select_m1 = digit_m1[signed_digit->length - 1];
+
+			for (unsigned int k = 0; k < algorithm_m; ++k) {
+				SLICES(onthefly_appended_digit)[k] = digit_bits[k];
+				SLICES(onthefly_appended_digit_m1)[k] = digit_m1[k];
+				SLICES(onthefly_appended_digit_t2)[k + 1] = digit_bits[k];
+				SLICES(onthefly_appended_digit_t2m1)[k + 1] = digit_m1[k];
+			}
+			SLICES(onthefly_appended_digit_t2)[0] = slice_fill(0);
+			SLICES(onthefly_appended_digit_t2m1)[0] = slice_fill(1);
+
+			// ON-THE-FLY CONVERSION: PART 2
+			// [2{S'}|s'], and its theoretical counterpart.
+			slice_clear(S0s);
+			slice_op_load(S0s, register_2S, algorithm_m, ~onthefly_select);
+			slice_op_load(S0s, register_2S_m1, algorithm_m, onthefly_select);
+			slice_op_load(S0s, onthefly_appended_digit, 0, slice_fill(1));
+
+			slice_clear(S0s_theoretical);
+			slice_op_load(S0s_theoretical, register_S, algorithm_m + 1, slice_fill(1));
+			slice_op_load(S0s_theoretical, digit_S, 0, slice_fill(1));
+
+			// update both residual registers, shifting them and adding
+			// both terms in one go
+			const struct slice_term terms[2] = {
+				{register_A, +1, partial_product_offset, digits_B[iteration]},
+				{S0s_theoretical, -1, linearquadratic_offset, digit_S}
+			};
+			const struct slice_term terms_practical[2] = {
+				{register_A, +1, partial_product_offset, digits_B[iteration]},
+				{S0s, -1, linearquadratic_offset, signed_digit}
+			};
+
+			slice_op_shift_accumulate(register_W, algorithm_m * 2, terms, 2);
+			if (algorithm_residual_carrysave)
+				slice_op_carrysave_accumulate(register_W_practical, register_W_practical_carry,
+					algorithm_m * 2, terms_practical, 2);
+			else
+				slice_op_shift_accumulate(register_W_practical, algorithm_m * 2, terms_practical, 2);
+
+			// update the result register {S}
+			slice_op_leftshift(register_S, algorithm_m);
+			slice_op_load(register_S, digit_S, 0, slice_fill(1));
+
+			// ON-THE-FLY CONVERSION: PART 3
+			slice_op_load(register_2S, register_S_m1, 0, onthefly_select);
+			slice_op_load(register_2S, register_S_practical, 0, ~onthefly_select);
+			slice_op_load(register_S_practical, register_S_m1, 0, onthefly_select);
+
+			slice_op_load(register_2S_m1, register_S_practical, 0, ~onthefly_select_m1);
+			slice_op_load(register_2S_m1, register_S_m1, 0, onthefly_select_m1);
+			slice_op_load(register_S_m1, register_S_practical, 0, ~onthefly_select_m1);
+
+			// Update the direct and "minus one" copies of the result
+			// and of the 2S registers
+			slice_op_leftshift(register_S_practical, algorithm_m);
+			slice_op_leftshift(register_S_m1, algorithm_m);
+			slice_op_load(register_S_practical, onthefly_appended_digit, 0, slice_fill(1));
+			slice_op_load(register_S_m1, onthefly_appended_digit_m1, 0, slice_fill(1));
+
+			slice_op_leftshift(register_2S, algorithm_m + 1);
+			slice_op_leftshift(register_2S_m1, algorithm_m + 1);
+			slice_op_load(register_2S, onthefly_appended_digit_t2, 0, slice_fill(1));
+			slice_op_load(register_2S_m1, onthefly_appended_digit_t2m1, 0, slice_fill(1));
+
+			// update the multiplicand register {A} and the P cursor
+			if (iteration < iterations)
+				slice_op_leftshift(register_A, algorithm_m);
+
+			P_cursor += algorithm_m;
+		}
+
+		// -------------------------------------
+		// check every lane
+		// -------------------------------------
+		const slice_t lane_diverged = slice_op_compare_zero(register_W);
+		// (either residual may overflow, as in "main.c")
+		const slice_t lane_overflowed = register_W->overflow | register_W_practical->overflow;
+		const slice_t lane_mismatched = slice_op_compare(register_S_practical, register_S);
+		const slice_t lane_failed =
+			lane_diverged | lane_overflowed | lane_mismatched | table_failure;
+
+		passed += SLICE_LANES - slice_count(lane_failed);
+		diverged += slice_count(lane_diverged);
+		overflowed += slice_count(lane_overflowed);
+		mismatched += slice_count(lane_mismatched);
+		table_failures += slice_count(table_failure);
+
+		// report the first few failing problems.
+		for (unsigned int lane = 0; lane < SLICE_LANES && reported < 8; ++lane) {
+			if (!slice_getlane(lane_failed, lane))
+				continue;
+
+			char *buffer1 = word_makemathematicacode(lane_A[lane]),
+			     *buffer2 = word_makemathematicacode(lane_B[lane]);
+
+			printf("FAILED%s%s%s%s: S(mathematica) = BaseForm[Sqrt[%s * %s],%d]\n",
+				   (slice_getlane(lane_diverged, lane) ? " (residual diverged)" : ""),
+				   (slice_getlane(lane_overflowed, lane) ? " (overflow)" : ""),
+				   (slice_getlane(lane_mismatched, lane) ? " (practical root differs)" : ""),
+				   (slice_getlane(table_failure, lane) ? " (forbidden table cell)" : ""),
+				   buffer1, buffer2, 1 << algorithm_m);
+
+			free(buffer1);
+			free(buffer2);
+			++reported;
+		}
+	}
+
+	const double seconds = elapsed_microseconds(&start) / 1e6;
+	const unsigned long long problems = (unsigned long long) batches * SLICE_LANES;
+
+	printf("-----------------------------------------------------------------------------\n"
+		   "Results:\n"
+		   " - problems:                 %llu\n"
+		   " - passed:                   %llu\n"
+		   " - residual diverged:        %llu\n"
+		   " - residual overflowed:      %llu\n"
+		   " - practical root differs:   %llu\n"
+		   " - forbidden table cells:    %llu\n"
+		   " - time:                     %.3f s (%.0f problems/s)\n",
+		   problems, passed, diverged, overflowed, mismatched, table_failures,
+		   seconds, (seconds > 0 ? problems / seconds : 0.0));
+
+	if (passed == problems)
+		printf("ALL PROBLEMS SUCCESSFULLY VERIFIED!\n");
+
+	// deallocate memory
+	for (unsigned int i = 0; i <= iterations; ++i)
+		slice_deallocate(digits_B[i]);
+	slice_deallocate(digit_S);
+	slice_deallocate(signed_digit);
+	slice_deallocate(onthefly_appended_digit);
+	slice_deallocate(onthefly_appended_digit_m1);
+	slice_deallocate(onthefly_appended_digit_t2);
+	slice_deallocate(onthefly_appended_digit_t2m1);
+	slice_deallocate(S0s);
+	slice_deallocate(S0s_theoretical);
+	slice_deallocate(register_S_prime);
+	slice_deallocate(register_W_practical_carry);
+	slice_deallocate(register_W_practical);
+	slice_deallocate(register_2S_m1);
+	slice_deallocate(register_2S);
+	slice_deallocate(register_S_m1);
+	slice_deallocate(register_S_practical);
+	slice_deallocate(register_W);
+	slice_deallocate(register_A);
+	slice_deallocate(register_S);
+
+	for (unsigned int lane = 0; lane < SLICE_LANES; ++lane) {
+		word_deallocate(lane_A[lane]);
+		word_deallocate(lane_B[lane]);
+	}
+	word_deallocate(S_prime);
+	word_deallocate(S);
+	word_deallocate(B);
+	word_deallocate(A);
+	word_deallocate(random_seed2);
+	word_deallocate(random_seed1);
+	system_parameters_deallocate(&parameters);
+
+	return 0;
+}
@@ -0,0 +1,660 @@
+/*
+ *  bitslice_library.h
+ *  mechanical project
+ *
+ *  the bit-sliced counterpart of the word library, which
+ *  simulates SLICE_LANES independent registers at once.
+ *
+ */
+
+#include <stdint.h>
+
+//
+// --- d o c u m e n t a t i o n --- s t a r t s --- h e r e
+//
+// BASIC CODE CONCEPTS:
+//
+// "slice word":
+//		is the bit-sliced counterpart of a "word" (see word_library.h), which holds the contents of
+//		the same hardware register for SLICE_LANES independent problems (or lanes) at once.
+//
+//
+// TECHNICAL DETAILS:
+//
+//  - storage:
+//		a slice word is stored as a header followed by one "slice" per bit of the register, where a
+//		slice packs the bit of that position for every lane: bit "i" of the register in lane "l" is
+//		found at the bit position "l" of slice "i". this way, every bitwise operation on two slices
+//		acts on all the lanes at once, and an addition becomes a chain of full adders built out of
+//		such operations, one slice at a time.
+//
+//  - lanes:
+//		a slice is a 64-bit integer (64 lanes), or a 256-bit (AVX2) or 512-bit (AVX-512) vector of
+//		them, as selected by SLICE_LANES, which defaults to the widest vector the target supports
+//		and may be defined before this file is included. the vectors rely on the vector extensions
+//		of gcc and clang, which fall back on 64-bit operations for targets that lack them.
+//
+//  - lane masks:
+//		the operations that act on some of the lanes only take a slice as a mask, with the bit of
+//		every affected lane set, and the integrity flags of a slice word are such masks too (there
+//		is an overflow flag per lane).
+//
+//  - digits:
+//		the digit by which a term is multiplied varies from one lane to the other, hence it is a
+//		slice word of its own (see "slice_term"), whose bits are added as shifted copies of the
+//		term, so a digit of "d" bits costs "d" additions.
+//
+// --- d o c u m e n t a t i o n --- e n d s --- h e r e
+//
+
+// the number of lanes, and the type of a slice.
+#if !defined(SLICE_LANES)
+#if defined(__AVX512F__)
+#define SLICE_LANES	512
+#elif defined(__AVX2__)
+#define SLICE_LANES	256
+#else
+#define SLICE_LANES	64
+#endif
+#endif
+
+#if 512 == SLICE_LANES
+typedef uint64_t slice_t __attribute__ ((vector_size (64)));
+#elif 256 == SLICE_LANES
+typedef uint64_t slice_t __attribute__ ((vector_size (32)));
+#elif 64 == SLICE_LANES
+typedef uint64_t slice_t;
+#else
+#error "SLICE_LANES should be 64, 256 or 512."
+#endif
+
+// this macro provides an easy way to access the slices
+// following the header of a slice word.
+#define SLICES(word)	((slice_t*) ((void*) (word) + sizeof(struct slice_header)))
+
+// the number of bytes taken by a slice word of "length"
+// bits, header included.
+#define SLICE_BYTES(length)	(sizeof(struct slice_header) + (length) * sizeof(slice_t))
+
+typedef struct slice_header {
+	// length of the register in binary bits, which is also
+	// the number of slices.
+	unsigned short length;
+	// a flag indicating whether the quantity stored in the
+	// register is signed (in all of the lanes).
+	unsigned char is_signed;
+	// the lanes in which an overflow occured, from either a
+	// left shift or an addition (see "word_header").
+	slice_t overflow;
+} *slice_pointer;
+
+// a term of "slice_op_shift_accumulate": the word, multiplied
+// by the (per-lane) digit, is added (sign = +1) or subtracted
+// (sign = -1) after a left shift of "offset" bits. a plain
+// term has no digit (NULL).
+typedef struct slice_term {
+	struct slice_header* word;
+	char sign;
+	unsigned short offset;
+	struct slice_header* digit;
+} slice_term;
+
+
+// --------------------------------------------------
+// slice_fill
+// --------------------------------------------------
+//   returns a slice with all the lanes set to "bit".
+// --------------------------------------------------
+slice_t slice_fill(unsigned char bit) {
+
+	const slice_t zero = {0};
+	return (bit ? ~zero : zero);
+}
+
+// --------------------------------------------------
+// slice_getlane
+// --------------------------------------------------
+unsigned char slice_getlane(slice_t slice, unsigned int lane) {
+
+	return (unsigned char) ((((uint64_t*) &slice)[lane / 64] >> (lane % 64)) & 1);
+}
+
+// --------------------------------------------------
+// slice_setlane
+// --------------------------------------------------
+void slice_setlane(slice_t* slice, unsigned int lane, unsigned char bit) {
+
+	uint64_t* const words = (uint64_t*) slice;
+
+	if (bit)
+		words[lane / 64] |= (uint64_t) 1 << (lane % 64);
+	else
+		words[lane / 64] &= ~((uint64_t) 1 << (lane % 64));
+}
+
+// --------------------------------------------------
+// slice_any
+// --------------------------------------------------
+//   tells whether any of the lanes of "slice" is set.
+// --------------------------------------------------
+unsigned char slice_any(slice_t slice) {
+
+	uint64_t any = 0;
+	for (unsigned int i = 0; i < SLICE_LANES / 64; ++i)
+		any |= ((uint64_t*) &slice)[i];
+
+	return (0 != any);
+}
+
+// --------------------------------------------------
+// slice_count
+// --------------------------------------------------
+//   returns the number of lanes of "slice" that are set.
+// --------------------------------------------------
+unsigned int slice_count(slice_t slice) {
+
+	unsigned int count = 0;
+	for (unsigned int i = 0; i < SLICE_LANES / 64; ++i)
+		count += (unsigned int) __builtin_popcountll(((uint64_t*) &slice)[i]);
+
+	return count;
+}
+
+// --------------------------------------------------
+// create_slice_word
+// --------------------------------------------------
+//   creates a slice word of "length" bits, which holds
+//   zero (unsigned) in all the lanes.
+//
+// warning:
+// - the slice word returned by this function call is
+//   dynamically allocated and hence should be freed
+//   manually using "slice_deallocate" to avoid memory
+//   leaks.
+// --------------------------------------------------
+struct slice_header* create_slice_word(unsigned short length) {
+
+	// the slices are aligned to their own size, as the
+	// vector instructions that load them expect.
+	void* memory = NULL;
+	const int return_value = posix_memalign(&memory, sizeof(slice_t), SLICE_BYTES(length));
+
+	assert(0 == return_value);
+	if (0 != return_value) {
+		perror("Couldn't allocate memory for a slice word.");
+		return NULL;
+	}
+
+	struct slice_header* word = memory;
+	memset(memory, 0, SLICE_BYTES(length));
+	word->length = length;
+
+	return word;
+}
+
+// --------------------------------------------------
+// slice_deallocate
+// --------------------------------------------------
+void slice_deallocate(struct slice_header* word) {
+
+	assert(NULL != word);
+	if (NULL == word) {
+		perror("NULL pointer passed to slice_deallocate.");
+		return;
+	}
+
+	free((void*) word);
+}
+
+// --------------------------------------------------
+// slice_readbit
+// --------------------------------------------------
+//   returns the slice of the bit "index" of "word", or
+//   the copies of its sign above its length, or zeros
+//   below its least-significant bit.
+// --------------------------------------------------
+slice_t slice_readbit(struct slice_header* word, int index) {
+
+	if (index < 0 || (!word->is_signed && index >= word->length))
+		return slice_fill(0);
+
+	if (index >= word->length)
+		return SLICES(word)[word->length - 1];
+
+	return SLICES(word)[index];
+}
+
+// --------------------------------------------------
+// slice_clear
+// --------------------------------------------------
+//   resets all the lanes of "word" to zero, along with
+//   their overflow flags.
+// --------------------------------------------------
+void slice_clear(struct slice_header* word) {
+
+	memset((void*) SLICES(word), 0, word->length * sizeof(slice_t));
+	word->overflow = slice_fill(0);
+}
+
+// --------------------------------------------------
+// slice_load_lane
+// --------------------------------------------------
+//   stores the value of "value" in the lane "lane" of
+//   "word", sign-extended (or truncated) to its length.
+// --------------------------------------------------
+void slice_load_lane(struct slice_header* word, unsigned int lane,
+					 struct word_header* value) {
+
+	WORD_VALIDATE(NULL != word && NULL != value && value->length > 0 && lane < SLICE_LANES,
+				  "Invalid arguments were passed to slice_load_lane.");
+
+	const unsigned char sign =
+		(value->is_signed ? word_getbit(value, value->length - 1) : 0);
+
+	for (unsigned int i = 0; i < word->length; ++i)
+		slice_setlane(&SLICES(word)[i], lane,
+					  (i < value->length ? word_getbit(value, i) : sign));
+}
+
+// --------------------------------------------------
+// slice_load_lane_constant
+// --------------------------------------------------
+//   stores the (signed) integer "value" in the lane
+//   "lane" of "word", see "slice_load_lane".
+// --------------------------------------------------
+void slice_load_lane_constant(struct slice_header* word, unsigned int lane, int value) {
+
+	WORD_VALIDATE(NULL != word && lane < SLICE_LANES,
+				  "Invalid arguments were passed to slice_load_lane_constant.");
+
+	for (unsigned int i = 0; i < word->length; ++i)
+		slice_setlane(&SLICES(word)[i], lane,
+					  (unsigned char) ((value >> (i < 31 ? i : 31)) & 1));
+}
+
+// --------------------------------------------------
+// slice_store_lane
+// --------------------------------------------------
+//   stores the value held by the lane "lane" of "word"
+//   in "result", sign-extended (or truncated) to its
+//   length.
+// --------------------------------------------------
+void slice_store_lane(struct word_header* result, struct slice_header* word,
+					  unsigned int lane) {
+
+	WORD_VALIDATE(NULL != word && NULL != result && result->length > 0 && lane < SLICE_LANES,
+				  "Invalid arguments were passed to slice_store_lane.");
+
+	for (unsigned int i = 0; i < result->length; ++i)
+		word_setbit(result, i, slice_getlane(slice_readbit(word, (int) i), lane));
+}
+
+// --------------------------------------------------
+// slice_op_load
+// --------------------------------------------------
+//   the counterpart of "word_op_load", copies the bits
+//   of "value" into "word" starting at the bit "position"
+//   (those that fall beyond its length are dropped), in
+//   the lanes set in "mask" only.
+// --------------------------------------------------
+void slice_op_load(struct slice_header* word, struct slice_header* value,
+				   unsigned short position, slice_t mask) {
+
+	WORD_VALIDATE(NULL != word && NULL != value,
+				  "Invalid word was passed to slice_op_load.");
+
+	slice_t* const destination = SLICES(word);
+	const slice_t* const source = SLICES(value);
+
+	for (unsigned int i = position, j = 0; i < word->length && j < value->length; ++i, ++j)
+		destination[i] = (destination[i] & ~mask) | (source[j] & mask);
+}
+
+// --------------------------------------------------
+// slice_op_leftshift
+// --------------------------------------------------
+//   the counterpart of "word_op_leftshift", which flags
+//   the lanes in which a meaningful bit was shifted out.
+// --------------------------------------------------
+void slice_op_leftshift(struct slice_header* word, unsigned short bitcount) {
+
+	WORD_VALIDATE(NULL != word && word->length > 0,
+				  "Invalid word was passed to slice_op_leftshift.");
+
+	slice_t* const bits = SLICES(word);
+	const unsigned int length = word->length;
+
+	// the bits shifted out must all be zeros (unsigned), or
+	// copies of the sign bit that follows them (signed).
+	slice_t lost = slice_fill(0);
+	const unsigned int first_lost = (bitcount < length ? length - bitcount : 0);
+	const slice_t reference = (word->is_signed && bitcount < length ?
+							   bits[first_lost - 1] : slice_fill(0));
+	for (unsigned int i = first_lost; i < length; ++i)
+		lost |= bits[i] ^ reference;
+	word->overflow |= lost;
+
+	for (unsigned int i = length; i-- > 0; )
+		bits[i] = (i >= bitcount ? bits[i - bitcount] : slice_fill(0));
+}
+
+// --------------------------------------------------
+// slice_op_shift_accumulate
+// --------------------------------------------------
+//   the counterpart of "word_op_shift_accumulate",
+//   shifts "result" to the left by "shift" bits and adds
+//   to it the "term_count" terms in "terms", each of them
+//   multiplied by its own digit in every lane:
+//
+//   result = result × 2^shift + Σ sign × digit × word × 2^offset
+//
+// notes:
+// - the sum is formed exactly, in slices wide enough to
+//   hold it, through a chain of full adders per digit bit
+//   (the most-significant bit of a signed digit weighs
+//   negatively, hence it is subtracted), and the overflow
+//   flag of a lane is set only if its final sum doesn't
+//   fit in "result".
+// - the terms are sign-extended according to their own
+//   types.
+// --------------------------------------------------
+void slice_op_shift_accumulate(struct slice_header* result, unsigned short shift,
+							   const struct slice_term* terms, unsigned int term_count) {
+
+	WORD_VALIDATE(NULL != result && result->length > 0,
+				  "Invalid result word was passed to slice_op_shift_accumulate.");
+
+	// the width of the exact sum, with one bit to spare for
+	// its sign.
+	unsigned int width = (unsigned int) result->length + shift;
+	for (unsigned int t = 0; t < term_count; ++t) {
+
+		WORD_VALIDATE(NULL != terms[t].word && (1 == terms[t].sign || -1 == terms[t].sign),
+					  "Invalid term was passed to slice_op_shift_accumulate.");
+
+		const unsigned int term_width = (unsigned int) terms[t].offset + terms[t].word->length +
+			(NULL == terms[t].digit ? 0 : terms[t].digit->length);
+		if (term_width > width)
+			width = term_width;
+	}
+	width += 2;
+
+	// the shifted result.
+	slice_t sum[width];
+	for (unsigned int i = 0; i < width; ++i)
+		sum[i] = slice_readbit(result, (int) i - shift);
+
+	for (unsigned int t = 0; t < term_count; ++t) {
+		const struct slice_term* term = &terms[t];
+		const unsigned int digit_bits = (NULL == term->digit ? 1 : term->digit->length);
+
+		for (unsigned int j = 0; j < digit_bits; ++j) {
+
+			// the lanes in which the digit has this bit set.
+			const slice_t mask = (NULL == term->digit ? slice_fill(1) : SLICES(term->digit)[j]);
+			if (!slice_any(mask))
+				continue;
+
+			// the most-significant bit of a signed digit weighs
+			// -2^j rather than 2^j.
+			const unsigned char negative = (NULL != term->digit && term->digit->is_signed &&
+											j == digit_bits - 1);
+			const unsigned char subtract = ((-1 == term->sign) != negative);
+
+			// a subtraction adds the inverted term plus one.
+			slice_t carry = slice_fill(subtract);
+			const slice_t inversion = slice_fill(subtract);
+
+			for (unsigned int i = term->offset + j; i < width; ++i) {
+				const slice_t addend =
+					(slice_readbit(term->word, (int) (i - term->offset - j)) & mask) ^ inversion;
+				const slice_t partial = sum[i] ^ addend;
+
+				const slice_t carry_out = (sum[i] & addend) | (partial & carry);
+				sum[i] = partial ^ carry;
+				carry = carry_out;
+			}
+		}
+	}
+
+	// the bits above the result must all be zeros (unsigned),
+	// or copies of its sign bit (signed).
+	slice_t lost = slice_fill(0);
+	const slice_t reference = (result->is_signed ? sum[result->length - 1] : slice_fill(0));
+	for (unsigned int i = result->length; i < width; ++i)
+		lost |= sum[i] ^ reference;
+	result->overflow |= lost;
+
+	memcpy((void*) SLICES(result), (void*) sum, result->length * sizeof(slice_t));
+}
+
+// --------------------------------------------------
+// slice_op_compare_zero
+// --------------------------------------------------
+//   returns the lanes in which "word" isn't zero.
+// --------------------------------------------------
+slice_t slice_op_compare_zero(struct slice_header* word) {
+
+	slice_t nonzero = slice_fill(0);
+	for (unsigned int i = 0; i < word->length; ++i)
+		nonzero |= SLICES(word)[i];
+
+	return nonzero;
+}
+
+// --------------------------------------------------
+// slice_op_compare
+// --------------------------------------------------
+//   returns the lanes in which "word1" and "word2" hold
+//   different values (both sign-extended).
+// --------------------------------------------------
+slice_t slice_op_compare(struct slice_header* word1, struct slice_header* word2) {
+
+	const unsigned int length =
+		1 + (word1->length > word2->length ? word1->length : word2->length);
+
+	slice_t different = slice_fill(0);
+	for (unsigned int i = 0; i < length; ++i)
+		different |= slice_readbit(word1, (int) i) ^ slice_readbit(word2, (int) i);
+
+	return different;
+}
+
+// --------------------------------------------------
+// slice_extract_bits
+// --------------------------------------------------
+//   the counterpart of "word_extract_bits", copies the
+//   "count" slices of "word" starting at the bit
+//   "position" into "field" (sign-extended, or zeros
+//   below the word), where the lanes set in "advance"
+//   read one bit higher.
+// --------------------------------------------------
+void slice_extract_bits(slice_t* field, struct slice_header* word, int position,
+						unsigned int count, slice_t advance) {
+
+	for (unsigned int k = 0; k < count; ++k) {
+		const slice_t bit = slice_readbit(word, position + (int) k);
+		const slice_t next_bit = slice_readbit(word, position + (int) k + 1);
+
+		field[k] = (bit & ~advance) | (next_bit & advance);
+	}
+}
+
+// --------------------------------------------------
+// slices_negate
+// --------------------------------------------------
+//   negates the (two's complement) field of "count"
+//   slices in the lanes set in "mask".
+// --------------------------------------------------
+void slices_negate(slice_t* field, unsigned int count, slice_t mask) {
+
+	// invert, then add one through a chain of half adders.
+	slice_t carry = mask;
+	for (unsigned int k = 0; k < count; ++k) {
+		const slice_t bit = field[k] ^ mask;
+		field[k] = bit ^ carry;
+		carry &= bit;
+	}
+}
+
+// --------------------------------------------------
+// slices_add_constant
+// --------------------------------------------------
+//   adds the (signed) integer "constant" to the field
+//   of "count" slices, in all the lanes.
+// --------------------------------------------------
+void slices_add_constant(slice_t* field, unsigned int count, int constant) {
+
+	slice_t carry = slice_fill(0);
+	for (unsigned int k = 0; k < count; ++k) {
+		const slice_t addend =
+			slice_fill((unsigned char) ((constant >> (k < 31 ? k : 31)) & 1));
+		const slice_t partial = field[k] ^ addend;
+
+		const slice_t carry_out = (field[k] & addend) | (partial & carry);
+		field[k] = partial ^ carry;
+		carry = carry_out;
+	}
+}
+
+// --------------------------------------------------
+// slices_equal_constant
+// --------------------------------------------------
+//   returns the lanes in which the field of "count"
+//   slices holds the bits of "value".
+// --------------------------------------------------
+slice_t slices_equal_constant(const slice_t* field, unsigned int count, unsigned int value) {
+
+	slice_t equal = slice_fill(1);
+	for (unsigned int k = 0; k < count; ++k)
+		equal &= ~(field[k] ^ slice_fill((unsigned char) ((value >> (k < 31 ? k : 31)) & 1)));
+
+	return equal;
+}
+
+// --------------------------------------------------
+// slice_op_carrysave_accumulate
+// --------------------------------------------------
+//   the counterpart of "word_op_carrysave_accumulate",
+//   shifts the carry-save word held in "sum" and "carry"
+//   to the left by "shift" bits and adds to it the
+//   "term_count" terms in "terms", each through a row of
+//   full adders of its own:
+//
+//   sum + carry = (sum + carry) × 2^shift + Σ sign × digit × word × 2^offset
+//
+// notes:
+// - a term is the product of its word by the magnitude of
+//   its digit, inverted in the lanes where it is subtracted,
+//   and the one that completes its negation takes the least-
+//   significant bit of the carry word, so that both words
+//   hold the same bits as those of "word_op_carrysave_
+//   accumulate" in every lane.
+// - the arithmetic is modulo 2^length, and the overflow
+//   flags of "sum" and "carry" are left untouched.
+// --------------------------------------------------
+void slice_op_carrysave_accumulate(struct slice_header* sum, struct slice_header* carry,
+								   unsigned short shift,
+								   const struct slice_term* terms, unsigned int term_count) {
+
+	WORD_VALIDATE(NULL != sum && NULL != carry && sum->length > 0 && sum->length == carry->length,
+				  "Invalid carry-save word was passed to slice_op_carrysave_accumulate.");
+
+	const unsigned int length = sum->length;
+
+	// the shifted sum and carry words (the bits shifted in
+	// are zeros).
+	slice_t sum_bits[length], carry_bits[length];
+	for (unsigned int i = 0; i < length; ++i) {
+		sum_bits[i] = (i >= shift ? SLICES(sum)[i - shift] : slice_fill(0));
+		carry_bits[i] = (i >= shift ? SLICES(carry)[i - shift] : slice_fill(0));
+	}
+
+	for (unsigned int t = 0; t < term_count; ++t) {
+		const struct slice_term* term = &terms[t];
+
+		WORD_VALIDATE(NULL != term->word && (1 == term->sign || -1 == term->sign),
+					  "Invalid term was passed to slice_op_carrysave_accumulate.");
+
+		// the magnitude of the digit, and the lanes in which
+		// the digit is negative.
+		const unsigned int digit_bits = (NULL == term->digit ? 1 : term->digit->length);
+		slice_t magnitude[digit_bits];
+		slice_t negative = slice_fill(0);
+		if (NULL == term->digit)
+			magnitude[0] = slice_fill(1);
+		else {
+			memcpy((void*) magnitude, (void*) SLICES(term->digit), sizeof(magnitude));
+			if (term->digit->is_signed)
+				negative = magnitude[digit_bits - 1];
+			slices_negate(magnitude, digit_bits, negative);
+		}
+
+		// the product, a shifted copy of the word per bit of
+		// the magnitude.
+		slice_t product[length];
+		for (unsigned int i = 0; i < length; ++i)
+			product[i] = slice_fill(0);
+
+		for (unsigned int j = 0; j < digit_bits; ++j) {
+			const slice_t mask = magnitude[j];
+			if (!slice_any(mask))
+				continue;
+
+			slice_t product_carry = slice_fill(0);
+			for (unsigned int i = term->offset + j; i < length; ++i) {
+				const slice_t addend =
+					slice_readbit(term->word, (int) (i - term->offset - j)) & mask;
+				const slice_t partial = product[i] ^ addend;
+
+				const slice_t carry_out = (product[i] & addend) | (partial & product_carry);
+				product[i] = partial ^ product_carry;
+				product_carry = carry_out;
+			}
+		}
+
+		// the lanes in which the term is subtracted.
+		const slice_t subtract = (-1 == term->sign ? ~negative : negative);
+
+		// the row of full adders.
+		slice_t majority_bit = subtract;
+		for (unsigned int i = 0; i < length; ++i) {
+			const slice_t added_bit = product[i] ^ subtract;
+			const slice_t majority = (sum_bits[i] & carry_bits[i]) |
+				(sum_bits[i] & added_bit) | (carry_bits[i] & added_bit);
+
+			sum_bits[i] ^= carry_bits[i] ^ added_bit;
+			carry_bits[i] = majority_bit;
+			majority_bit = majority;
+		}
+	}
+
+	memcpy((void*) SLICES(sum), (void*) sum_bits, sizeof(sum_bits));
+	memcpy((void*) SLICES(carry), (void*) carry_bits, sizeof(carry_bits));
+}
+
+// --------------------------------------------------
+// slice_carrysave_estimate
+// --------------------------------------------------
+//   the counterpart of "word_carrysave_estimate", adds
+//   the "count" bits of "sum" and "carry" starting at the
+//   bit "position" (see "slice_extract_bits") into "field",
+//   with a carry-propagate adder only "count" bits wide.
+// --------------------------------------------------
+void slice_carrysave_estimate(slice_t* field, struct slice_header* sum,
+							  struct slice_header* carry, int position,
+							  unsigned int count, slice_t advance) {
+
+	slice_t carry_field[count];
+	slice_extract_bits(field, sum, position, count, advance);
+	slice_extract_bits(carry_field, carry, position, count, advance);
+
+	slice_t field_carry = slice_fill(0);
+	for (unsigned int k = 0; k < count; ++k) {
+		const slice_t partial = field[k] ^ carry_field[k];
+
+		const slice_t carry_out = (field[k] & carry_field[k]) | (partial & field_carry);
+		field[k] = partial ^ field_carry;
+		field_carry = carry_out;
+	}
+}
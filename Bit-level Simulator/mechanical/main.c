@@ -4,523 +4,852 @@
 #include <sys/time.h>
 #include <string.h>
 #include <assert.h>
+#include <unistd.h>
 
 #include "randomizer.h"
+
+// Enable this line to build the word library with its "throughput"
+// checking policy (no argument validation, fewer integrity flags)
+#define WORD_POLICY_THROUGHPUT
+#undef WORD_POLICY_THROUGHPUT
+
 #include "word_library.h"
+#include "scheduler_library.h"
+#include "parameters_library.h"
 
 // Enable this line to suppress solution details
+// (which are only ever displayed for a single problem, the
+// problems of a batch run silently either way)
 #define SUPPRESS_DETAILS
 #undef SUPPRESS_DETAILS
 
-int main (int argc, const char * argv[]) {
+// --------------------------------------------------
+// problem_outcome
+// --------------------------------------------------
+//   the outcome of a problem run by "simulate_problem".
+// --------------------------------------------------
+enum problem_outcome {
+	PROBLEM_PASSED = 0,
+	// the residual was not eliminated, or the practical
+	// result differs from the theoretical one.
+	PROBLEM_DIVERGED,
+	// one of the residual registers overflowed.
+	PROBLEM_OVERFLOWED,
+	// the SRT table was indexed out of its range, or a
+	// forbidden cell of it was invoked.
+	PROBLEM_TABLE_FAILURE,
 
-	// initializing the randomizer ensures that the random bits
-	// provided through random_bit will be different each time
-	// the program is executed.
-	if (-1 == initialize_randomizer()) return -1;
-	
-	// independent system parameters
-	//   - SET 1: BASIC-THEORETICAL
-	const unsigned short 
-		algorithm_m = 2,
-		algorithm_n = 10,
-		algorithm_Z = 4;
-	
-	//   - SET 2: BASIC-PRACTICAL
-	const unsigned short
-		algorithm_alpha = 3,
-		algorithm_beta = 3,
-		algorithm_ns = 3,
-		algorithm_np = 5,
-		algorithm_np_fractional = 2,
-		algorithm_table_unsigned = 1;
-	
-	const short SRT_table[][5] = {
-		{4, 4, 4, 3},
-		{4, 4, 4, 3},
-		{4, 4, 4, 3},
-		{4, 4, 4, 3},
-		{4, 4, 3, 3},
-		{4, 4, 3, 3},
-		{4, 4, 3, 3},
-		{4, 4, 3, 3},
-		{4, 3, 3, 3},
-		{4, 3, 3, 3},
-		{4, 3, 3, 3},
-		{4, 3, 3, 3},
-		{3, 3, 3, 3},
-		{3, 3, 3, 2},
-		{3, 3, 3, 2},
-		{3, 3, 3, 2},
-		{3, 3, 3, 2},
-		{3, 3, 2, 2},
-		{3, 3, 2, 2},
-		{3, 2, 2, 2},
-		{3, 2, 2, 2},
-		{3, 2, 2, 1},
-		{2, 2, 2, 1},
-		{2, 2, 2, 1},
-		{2, 2, 2, 1},
-		{2, 1, 1, 1},
-		{2, 1, 1, 1},
-		{1, 1, 1, 1},
-		{1, 1, 1, 1},
-		{1, 0, 0, 0},
-		{1, 0, 0, 0},
-		{0, 0, 0, 0},
-		{0, 0, 0, 0}
-	};
+	PROBLEM_OUTCOMES
+};
 
-	const unsigned short SRT_table_dimensions[] = {33,4};
-	const unsigned short SRT_table_p0 = 8 << algorithm_np_fractional;
-	
-	const unsigned short 
-		SRT_table_mappings[][3] = {{0,0,0}};
-	const unsigned short 
-		SRT_table_mappings_count = 0;
-	
-	
-	// dependent system parameters
-	// (following thesis notation)
-	const unsigned short iterations =
-		(unsigned short) algorithm_n + ceil((double) (algorithm_Z + 2) / algorithm_m);
-	const unsigned short delta = 
-		(unsigned short) floor((double) algorithm_Z / algorithm_m) + 1;
-	//const unsigned short sigma = 
-	//	(unsigned short) floor((double) (algorithm_Z + algorithm_ns) / algorithm_m) + 1;
-	
-	//const unsigned short ma = algorithm_Z - algorithm_m * floor((double) algorithm_Z / algorithm_m);
-	const unsigned short mb = algorithm_m * ceil((double) algorithm_Z / algorithm_m) - algorithm_Z;
-	
-	// processor_size denotes the width of the calculations in
-	// the processor which is also equal to the bit length of
-	// different variables/operands.
-	const unsigned short processor_size = algorithm_m * algorithm_n;
-	word_pointer random_seed1 = NULL, random_seed2 = NULL;
-	word_pointer A = NULL, B = NULL, S = NULL;
-	
-	// To result in an exact square root we require that the
-	// choice of algorithm_m and algorithm_n result in an even
-	// value for "processor_size".
-	
-	// the plan for producing random operands and an exact 
-	// square root:
-	//
-	// A (multiplicand) = (1st random seed)^2
-	// B (multiplier)   = (2nd random seed)^2
-	//  A × B = (1st random seed × 2nd random seed)^2
-	// √A × B = (1st random seed × 2nd random seed)
-	//
-	// note: since both "A" and "B" are required to have a
-	// normalized size equal to "processor_size", and since
-	// both are formed by the means of squaring a number
-	// (doubling its bit length), we need "processor_size"
-	// to be even (divisible by two).
-	
-	assert((1 & processor_size) == 0 && "PROCESSOR BIT SIZE SHOULD BE AN EVEN VALUE");
-	if ((1 & processor_size) != 0) {
-		perror("PROCESSOR BIT SIZE SHOULD BE AN EVEN VALUE");
-		return 0;
-	}
-	
-	// generate the half-size random seeds
-	random_seed1 = create_word(processor_size >> 1);
-	random_seed2 = create_word(processor_size >> 1);
+// the names of the outcomes, as displayed
+const char* const problem_outcome_names[PROBLEM_OUTCOMES] = {
+	"passed", "residual diverged", "residual overflowed", "table failure"
+};
 
-	word_randomize(random_seed1);
-	word_randomize(random_seed2);
-	
-	// compute the random operand values (the multiplier
-	// B and multiplicand A)
-	A = create_word(processor_size);
-	B = create_word(processor_size);
-	
-	word_op_multiply(A, random_seed1, random_seed1);
-	word_op_multiply(B, random_seed2, random_seed2);
-	
-	assert(!A->overflow && !A->underflow && "INCORRECT RANDOM GENERATION OF THE MULTIPLICAND A");
-	assert(!B->overflow && !B->underflow && "INCORRECT RANDOM GENERATION OF THE MULTIPLIER B");	
-	if (A->overflow || A->underflow || B->overflow || B->underflow) {
-		return 0;
-	}
-	
-	// compute the exact square root
-	S = create_word(processor_size);
+// --------------------------------------------------
+// simulator
+// --------------------------------------------------
+//   the operands and the hardware registers of the
+//   algorithm, which are allocated once for a set of
+//   system parameters (see "create_simulator") and then
+//   reused by every problem run by "simulate_problem".
+// --------------------------------------------------
+struct simulator {
+	const struct system_parameters* parameters;
 
-	word_op_multiply(S, random_seed1, random_seed2);
-	assert(!S->overflow && !S->underflow && "INCORRECT RANDOM GENERATION OF THE SQUARE ROOT S");
-	if (S->overflow || S->underflow) {
-		return 0;
-	}
-	
-	printf(
-		"-----------------------------------------------------------------------------\n"		   
-		"           ORWA-AMIN MULTIPLICATIVE SQUARE-ROOT ALGORITHM SIMULATOR          \n"
-		"-----------------------------------------------------------------------------\n"
-		" Configuration: <ADVANCED> \n"
-		" - Signed-digit result with on-the-fly conversion of digits: YES\n"
-		" - Supports rounding: YES\n"
-		" - Actual digit selection: YES\n"
-		" - Digit selection using an actual table: YES\n"
-		" - Carry-Save residual: YES\n"
-		" - Signed-digit multiplier B with automatic conversion: NO\n"
-		"-----------------------------------------------------------------------------\n"
-		   );
-	
-	printf("System parameters:\n"
-		   " - m: %d bits\t\t→ RADIX = %d\n - n: %d iterations\n - Z: %d bits\n"
-		   "\nSystem variables:\n"
-		   " - size of operands:    %d bits\n"			// "m × n ="
-		   " - iterations:			%d iteration(s)\n",	// "n + ⎡Z+2/m⎤ = "
-		   algorithm_m, 1 << algorithm_m, algorithm_n, algorithm_Z, 
-		   processor_size, iterations);
-	
-	char *buffer1, *buffer2, *buffer3;
-	
-	buffer1 = word_makestring(A, 1 << algorithm_m);
-	buffer2 = word_makestring(B, 1 << algorithm_m);	
-	buffer3 = word_makestring(S, 1 << algorithm_m);		
-	printf(
+	// the random seeds, the operands and the square root
+	// (both direct and delayed) of the current problem.
+	word_pointer random_seed1, random_seed2;
+	word_pointer A, B, S, S_prime;
+
+	// the digits of S' and B, in the format of "word_makelist"
+	unsigned int* S_prime_digits;
+	int* B_digits;
+	unsigned int S_prime_digits_capacity, B_digits_capacity;
+
+	// the hardware registers (see "create_simulator")
+	word_pointer register_S, register_A, register_W;
+	word_pointer register_S_practical, register_S_m1;
+	word_pointer register_2S, register_2S_m1;
+	struct carrysave_word register_W_practical;
 #if !defined(SUPPRESS_DETAILS)
-		   "-----------------------------------------------------------------------------\n"		   
-		   " TYPE OF SIMULATION: One-problem demonstration S = √A × B\n"
-		   "-----------------------------------------------------------------------------\n"
-#else
-		   "-----------------------------------------------------------------------------\n"		   
-		   " TYPE OF SIMULATION: One-problem verification\n"
-		   "-----------------------------------------------------------------------------\n"		   
+	word_pointer register_W_resolved;
 #endif
-		   "Problem data:\n"
-		   " - A : %s (size = %d bits, radix = %d)\n"
-		   " - B : %s (size = %d bits, radix = %d)\n"
-		   " - S : %s (size = %d bits, radix = %d)\n",
-		buffer1, processor_size, 1 << algorithm_m, 
-		buffer2, processor_size, 1 << algorithm_m,
-		buffer3, processor_size, 1 << algorithm_m);
-		   
-	free(buffer1);
-	free(buffer2);
-	free(buffer3);	
-	
-	// Prepare the digits of the precomuputed  square root to
-	// feed them serially to the algorithm. Note that the square
-	// root produced or demanded by the algorithm is the delayed
-	// (S'), rather than the direct square root (S). The differe-
-	// nce is that S' has Z leading zero bits as compared to S.
-	word_pointer S_prime = create_word(
-				algorithm_Z + processor_size + mb);
-	word_op_load(S_prime, S, mb);
-	
-	unsigned int *S_prime_digits = word_makelist(S_prime, algorithm_m);
-	
-	/*
-	assert(S_prime_digits[0] == (iterations) && 
-		   "NOT ENOUGH RESULT DIGITS PRODUCED");
-	if (S_prime_digits[0] != (iterations)) {
-		perror("NOT ENOUGH RESULT DIGITS PRODUCED");
-		return 0;
-	}
-	 */
-	
-	
-	printf(" - S': %s (size = %d bits)\n\n",
-		   buffer1 = word_makestring(S_prime, 1 << algorithm_m),
-		   processor_size + algorithm_Z);
+	word_pointer P_mask;
+
+	// the few-bit registers, whose limbs are held by the
+	// simulator itself.
+	struct small_word P_storage;
+#if !defined(SUPPRESS_DETAILS)
+	struct small_word Sdot_storage;
+#endif
+	struct small_word digit_multiplier_storage[3];
+	struct small_word onthefly_appended_digit_storage[4];
+	word_pointer P, Sdot;
+	word_pointer digit_multiplier_B, digit_multiplier_S, digit_multiplier_S_practical;
+	word_pointer onthefly_appended_digit, onthefly_appended_digit_m1;
+	word_pointer onthefly_appended_digit_t2, onthefly_appended_digit_t2m1;
+
+	// the per-iteration temporaries
+	word_arena_pointer iteration_arena;
+
+	// the generator of the random seeds, NULL for the global
+	// one of "rand" (see "word_randomize_with").
+	struct random_generator* generator;
+
+	// the iteration of the SRT table look-up to blame for the
+	// failure of the last problem and the cell it read, the
+	// iteration being zero if the problem passed (see
+	// "simulate_problem").
+	unsigned short failure_iteration;
+	unsigned int failure_cell[2];
+};
+
+// --------------------------------------------------
+// simulator_deallocate
+// --------------------------------------------------
+//   releases the registers of "simulator", including
+//   those of a simulator whose creation failed (the ones
+//   it couldn't allocate being NULL).
+// --------------------------------------------------
+void simulator_deallocate(struct simulator* simulator) {
+
+	word_pointer words[] = {
+		simulator->register_W,
+		simulator->register_W_practical.sum, simulator->register_W_practical.carry,
+#if !defined(SUPPRESS_DETAILS)
+		simulator->register_W_resolved,
+#endif
+		simulator->register_A, simulator->register_2S, simulator->register_2S_m1,
+		simulator->register_S, simulator->register_S_practical, simulator->register_S_m1,
+		simulator->P_mask, simulator->S_prime, simulator->S,
+		simulator->random_seed2, simulator->random_seed1, simulator->B, simulator->A
+	};
+
+	if (NULL != simulator->iteration_arena)
+		arena_deallocate(simulator->iteration_arena);
+
+	for (unsigned int i = 0; i < sizeof(words) / sizeof(words[0]); ++i)
+		if (NULL != words[i])
+			word_deallocate(words[i]);
+
+	free(simulator->B_digits);
+	free(simulator->S_prime_digits);
+}
+
+// --------------------------------------------------
+// create_simulator
+// --------------------------------------------------
+//   allocates the operands and the hardware registers
+//   needed to run problems under "parameters" into
+//   "simulator", and returns "simulator" (or NULL, with
+//   nothing left allocated, should an allocation fail).
+//
+// warning:
+// - "parameters" should outlive the simulator, which
+//   should be freed using "simulator_deallocate".
+// --------------------------------------------------
+struct simulator* create_simulator(struct simulator* simulator,
+								   const struct system_parameters* parameters) {
+
+	const unsigned short algorithm_m = parameters->algorithm_m;
+	const unsigned short algorithm_n = parameters->algorithm_n;
+	const unsigned short algorithm_Z = parameters->algorithm_Z;
+	const unsigned short algorithm_np = parameters->algorithm_np;
+	const unsigned short processor_size = parameters->processor_size;
+	const unsigned short register_S_size = parameters->register_S_size;
+	const unsigned short register_A_size = parameters->register_A_size;
+	const unsigned short register_W_size = parameters->register_W_size;
+
+	// (the allocations that are missing, should the creation
+	// fail half-way, are left NULL for "simulator_deallocate")
+	memset((void*) simulator, 0, sizeof(struct simulator));
+
+	simulator->parameters = parameters;
+	simulator->generator = NULL;
+
+	// the half-size random seeds, the operands (the multiplier
+	// B and multiplicand A) and the exact square root.
+	simulator->random_seed1 = create_word(processor_size >> 1);
+	simulator->random_seed2 = create_word(processor_size >> 1);
+	simulator->A = create_word(processor_size);
+	simulator->B = create_word(processor_size);
+	simulator->S = create_word(processor_size);
+
+	// the delayed square root S', which has Z leading zero
+	// bits as compared to S.
+	const unsigned short S_prime_size = algorithm_Z + processor_size + parameters->mb;
+	simulator->S_prime = create_word(S_prime_size);
+
+	simulator->S_prime_digits_capacity =
+		(S_prime_size + algorithm_m - 1) / algorithm_m + 1;
+	simulator->B_digits_capacity =
+		(processor_size + algorithm_m - 1) / algorithm_m + 1;
+	simulator->S_prime_digits = malloc(sizeof(unsigned int) * simulator->S_prime_digits_capacity);
+	simulator->B_digits = malloc(sizeof(int) * simulator->B_digits_capacity);
 
-	free(buffer1);
-	
-	// Similarly, prepare the digits of the multiplier to be
-	// consumed easily by the algorithm.
-	unsigned int *B_digits = word_makelist(B, algorithm_m);
-	
 	// -------------------------------------
-	// define all the hardware registers 
+	// define all the hardware registers
 	// needed by the algorithm.
 	// -------------------------------------
-	const unsigned short register_S_size = 
-		algorithm_m * (iterations) - algorithm_Z;
-	const unsigned short register_A_size = 
-		algorithm_m * (iterations + algorithm_n - 2);
-	const unsigned short register_W_size = 
-		algorithm_m * (iterations + algorithm_n + 2) + algorithm_Z + 1;
-	
-	word_pointer register_S = create_word(register_S_size);
-	word_pointer register_A = create_word(register_A_size);
-	word_pointer register_W = create_word(register_W_size);
-	
-	// This is the actual result register in a practical 
+	simulator->register_S = create_word(register_S_size);
+	simulator->register_A = create_word(register_A_size);
+	simulator->register_W = create_word(register_W_size);
+
+	// This is the actual result register in a practical
 	// implementation of the algorithm, it is formed through
 	// on-the-fly conversion of result digits as returned
 	// by the SRT table.
 	// (On-the-fly appending of signed digits require that
 	// we maintain two registers, one to hold {S'} and the
 	// other to hold {S'} - 1 -this is the one named "S_m1")
-	word_pointer register_S_practical = create_word(register_S_size);	
-	word_pointer register_S_m1 = create_word(register_S_size);	
-	
+	simulator->register_S_practical = create_word(register_S_size);
+	simulator->register_S_m1 = create_word(register_S_size);
+
 	// Similar to the above, we maintain two registers to
 	// hold 2{S'} and 2{S'} - 1, to ease the formation of the
 	// value [2{S'}|s'] within the on-the-fly conversion unit,
 	// which is needed for the formation of the linear-
 	// quadratic term.
-	word_pointer register_2S    = create_word(register_S_size + 1);	
-	word_pointer register_2S_m1 = create_word(register_S_size + 1);
-	
+	simulator->register_2S    = create_word(register_S_size + 1);
+	simulator->register_2S_m1 = create_word(register_S_size + 1);
+
 	// this is the actual residual register in a practical
 	// implementation of the algorithm, which follows the
 	// pace of the practical result register.
-	word_pointer register_W_practical = create_word(register_W_size);
-	
-	// mechanisms needed for the extraction of the shifted 
+	// it is kept in a carry-save format (a sum word and a
+	// carry word), so that no carry has to travel its whole
+	// width when it is updated.
+	// (unless "algorithm_residual_carrysave" is cleared, in
+	// which case the carry word stays at zero and the sum word
+	// is updated with a carry-propagate adder)
+	if (NULL == create_carrysave_word(&simulator->register_W_practical, register_W_size))
+		simulator->register_W_practical.sum = simulator->register_W_practical.carry = NULL;
+
+#if !defined(SUPPRESS_DETAILS)
+	// the value of the practical residual, resolved through
+	// a carry-propagate adder for display only.
+	simulator->register_W_resolved = create_word(register_W_size);
+#endif
+
+	// mechanisms needed for the extraction of the shifted
 	// partial residual P as required by digit-selection
 	// (to be used to index the SRT table)
-	word_pointer P_mask = create_word(register_W_size);
+	simulator->P_mask = create_word(register_W_size);
 	// contains both the fractional and the integral parts
 	// of the P sample (Ptruncated).
-	word_pointer P = create_word(algorithm_np + 1 /* sign bit */ + 1 /* loose bit shift */);
-	
+	// (like the other few-bit words below, it is a small word
+	// held by the simulator itself).
+	simulator->P = create_small_word(&simulator->P_storage,
+		algorithm_np + 1 /* sign bit */ + 1 /* loose bit shift */);
+
 	// the truncated fractional result "Sdot" which is needed
 	// for indexing the SRT table.
 	// the one is to account for the loose bit
-	word_pointer Sdot = create_word(algorithm_ns + 1 /* loose-bit shift */);
+	// (the table look-up reads it straight from the result
+	// register, the word is only kept for display)
+#if !defined(SUPPRESS_DETAILS)
+	simulator->Sdot = create_small_word(&simulator->Sdot_storage,
+		parameters->algorithm_ns + 1 /* loose-bit shift */);
+#else
+	simulator->Sdot = NULL;
+#endif
 	// the integral bit is not needed to index the table when
 	// using a First-Digit Selector
-	
-	// the least-significant bit position of the residual sample,
-	// known in the SRT division world as the partial shifted 
-	// residual P.
-	// the minus one is to account for the case when 2P has to
-	// be passed to the table.
-	unsigned short P_cursor = 
-		(algorithm_m * algorithm_n + algorithm_Z) - algorithm_np_fractional - 1;
-	// the mask needed to pass that sample out of the residual W
-	word_op_load_constant(P_mask, ~0, P_cursor, 
-						  algorithm_np + 1 /* sign bit */ + 1 /* loose bit shift */);
-	
+
+	// the allocations made so far are checked at once, the
+	// simulator being released as a whole if any of them failed.
+	{
+		word_pointer words[] = {
+			simulator->random_seed1, simulator->random_seed2,
+			simulator->A, simulator->B, simulator->S, simulator->S_prime,
+			simulator->register_S, simulator->register_A, simulator->register_W,
+			simulator->register_S_practical, simulator->register_S_m1,
+			simulator->register_2S, simulator->register_2S_m1,
+			simulator->register_W_practical.sum,
+#if !defined(SUPPRESS_DETAILS)
+			simulator->register_W_resolved, simulator->Sdot,
+#endif
+			simulator->P_mask, simulator->P
+		};
+
+		unsigned char failed = (NULL == simulator->S_prime_digits || NULL == simulator->B_digits);
+		for (unsigned int i = 0; i < sizeof(words) / sizeof(words[0]); ++i)
+			failed |= (NULL == words[i]);
+
+		if (failed) {
+			perror("Couldn't allocate memory for the registers of a simulator.");
+			simulator_deallocate(simulator);
+			return NULL;
+		}
+	}
+
 	// make the W register of the signed type, to ensure that
 	// a potential case of overflow is correctly interpreted.
-	register_W->is_signed = 1;
-	// No carry-save format for the residual yet. So it is
-	// also signed, and the sample P also.
-	register_W_practical->is_signed = 1;
-	P->is_signed = 1;
-
-	word_pointer digit_multiplier_B = create_word(algorithm_m);
-	word_pointer digit_multiplier_S = create_word(algorithm_m);	
-	
+	simulator->register_W->is_signed = 1;
+	// The carry-save residual is also signed (through its
+	// sum word), and so is the sample P.
+	simulator->register_W_practical.sum->is_signed = 1;
+	simulator->P->is_signed = 1;
+#if !defined(SUPPRESS_DETAILS)
+	simulator->register_W_resolved->is_signed = 1;
+#endif
+
+	// the multiplier digit is signed, with an extra bit for the
+	// most-significant signed digit which may reach 2^m.
+	simulator->digit_multiplier_B =
+		create_small_word(&simulator->digit_multiplier_storage[0], algorithm_m + 2);
+	simulator->digit_multiplier_B->is_signed = 1;
+	simulator->digit_multiplier_S =
+		create_small_word(&simulator->digit_multiplier_storage[1], algorithm_m);
+
 	// The result digit returned by an actual SRT-table look
 	// up. Note that unlike the precomputed digit above, this
 	// digit is signed and hence needs an extra sign bit.
-	word_pointer digit_multiplier_S_practical = create_word(algorithm_m + 1);		
-	digit_multiplier_S_practical->is_signed = 1;
+	simulator->digit_multiplier_S_practical =
+		create_small_word(&simulator->digit_multiplier_storage[2], algorithm_m + 1);
+	simulator->digit_multiplier_S_practical->is_signed = 1;
 
 	// These are the unsigned digit values to be appended to
-	// the current root Si-1 as part of the on-the-fly 
+	// the current root Si-1 as part of the on-the-fly
 	// conversion circuitry logic.
 	// Note that two digit values are needed to update Si-1,
-	// one to update the direct amount and another one to 
+	// one to update the direct amount and another one to
 	// update the amount minus 1.
-	word_pointer onthefly_appended_digit = create_word(algorithm_m);
-	word_pointer onthefly_appended_digit_m1 = create_word(algorithm_m);
-	
+	simulator->onthefly_appended_digit =
+		create_small_word(&simulator->onthefly_appended_digit_storage[0], algorithm_m);
+	simulator->onthefly_appended_digit_m1 =
+		create_small_word(&simulator->onthefly_appended_digit_storage[1], algorithm_m);
+
 	// These on the other hand are the unsigned m+1-bit values
 	// to be appended to the current root Si-1 to result in
-	// 2Si, an amount that will be used in the following 
+	// 2Si, an amount that will be used in the following
 	// iteration to construct the linear-quadratic term.
 	// (this term is formed by concatenating 2Si-1 with si)
 	// (note that t2 is read "times two")
-	word_pointer onthefly_appended_digit_t2 = create_word(algorithm_m + 1);
-	word_pointer onthefly_appended_digit_t2m1 = create_word(algorithm_m + 1);
-	
+	simulator->onthefly_appended_digit_t2 =
+		create_small_word(&simulator->onthefly_appended_digit_storage[2], algorithm_m + 1);
+	simulator->onthefly_appended_digit_t2m1 =
+		create_small_word(&simulator->onthefly_appended_digit_storage[3], algorithm_m + 1);
+
+	// the per-iteration temporaries (S0s, its theoretical
+	// counterpart and the words used to display the terms and
+	// the expected residual) are taken out of an arena that is
+	// reset at the end of every iteration.
+	simulator->iteration_arena = create_word_arena(
+		WORD_BYTES(algorithm_m * (algorithm_n + 1)) + 6 * WORD_BYTES(register_W_size) +
+		WORD_BYTES(processor_size) + WORD_BYTES(processor_size << 1));
+
+	if (NULL == simulator->iteration_arena) {
+		perror("Couldn't allocate memory for the temporaries of a simulator.");
+		simulator_deallocate(simulator);
+		return NULL;
+	}
+
+	return simulator;
+}
+
+// --------------------------------------------------
+// seed_leading_ones
+// --------------------------------------------------
+//   returns the number of leading bits that are set in
+//   the seeds of the problems run under "parameters":
+//   the most-significant one (the seeds are normalized),
+//   and the next one as well if the SRT table ignores
+//   the loose-bit signal, as such a table needs results
+//   with a leading one.
+// --------------------------------------------------
+unsigned short seed_leading_ones(const struct system_parameters* parameters) {
+	return (parameters->algorithm_loose_bit ? 1 : 2);
+}
+
+// --------------------------------------------------
+// simulator_randomize
+// --------------------------------------------------
+//   draws the seeds of the next problem to be run by
+//   "simulator" out of its random generator.
+// --------------------------------------------------
+void simulator_randomize(struct simulator* simulator) {
+
+	word_randomize_with(simulator->random_seed1, simulator->generator);
+	word_randomize_with(simulator->random_seed2, simulator->generator);
+
+	// fix for producing a result with a leading one
+	if (2 == seed_leading_ones(simulator->parameters)) {
+		word_setbit(simulator->random_seed1, simulator->random_seed1->length - 2, 1);
+		word_setbit(simulator->random_seed2, simulator->random_seed2->length - 2, 1);
+	}
+}
+
+// --------------------------------------------------
+// simulator_load_seeds
+// --------------------------------------------------
+//   sets the seeds of the next problem to be run by
+//   "simulator" to "seed1" and "seed2".
+//
+// notes:
+// - the seeds are limited to 32 bits, and should have
+//   their leading bits set (see "seed_leading_ones")
+//   just like the ones drawn by "simulator_randomize".
+// --------------------------------------------------
+void simulator_load_seeds(struct simulator* simulator, uint32_t seed1, uint32_t seed2) {
+
+	word_clear(simulator->random_seed1);
+	word_clear(simulator->random_seed2);
+
+	word_op_load_constant(simulator->random_seed1, seed1, 0, simulator->random_seed1->length);
+	word_op_load_constant(simulator->random_seed2, seed2, 0, simulator->random_seed2->length);
+}
+
+// --------------------------------------------------
+// elapsed_microseconds
+// --------------------------------------------------
+double elapsed_microseconds(struct timeval* start) {
+
+	struct timeval now;
+	gettimeofday(&now, NULL);
+
+	return (now.tv_sec - start->tv_sec) * 1e6 + (now.tv_usec - start->tv_usec);
+}
+
+// --------------------------------------------------
+// simulate_problem
+// --------------------------------------------------
+//   runs the algorithm on the problem formed out of the
+//   seeds of "simulator" (see "simulator_randomize" and
+//   "simulator_load_seeds"), using its registers, and
+//   returns its outcome. the problem and its result are
+//   only displayed if "verbose" is set.
+//
+// notes:
+// - should the problem fail, the SRT table look-up to
+//   blame is left in "simulator->failure_iteration" and
+//   "simulator->failure_cell": the one that failed, or
+//   the first one after which the practical result could
+//   no longer converge to the theoretical one (the last
+//   one if there is no such look-up). an iteration equal
+//   to "delta" stands for the First-Digit Selector (or
+//   the hardwired first digit, see "algorithm_first_
+//   digit").
+// --------------------------------------------------
+enum problem_outcome simulate_problem(struct simulator* simulator, unsigned char verbose) {
+
+	// the system parameters and the registers, under the names
+	// used by the algorithm below.
+	const struct system_parameters* parameters = simulator->parameters;
+
+	const unsigned short
+		algorithm_m = parameters->algorithm_m,
+		algorithm_n = parameters->algorithm_n,
+		algorithm_Z = parameters->algorithm_Z;
+	const unsigned short
+		algorithm_alpha = parameters->algorithm_alpha,
+		algorithm_beta = parameters->algorithm_beta,
+		algorithm_ns = parameters->algorithm_ns,
+		algorithm_np = parameters->algorithm_np,
+		algorithm_np_fractional = parameters->algorithm_np_fractional,
+		algorithm_table_unsigned = parameters->algorithm_table_unsigned;
+	const unsigned char algorithm_residual_carrysave = parameters->algorithm_residual_carrysave;
+	const unsigned char algorithm_multiplier_signed = parameters->algorithm_multiplier_signed;
+	const unsigned char
+		algorithm_first_digit = parameters->algorithm_first_digit,
+		algorithm_initialroot = parameters->algorithm_initialroot,
+		algorithm_loose_bit = parameters->algorithm_loose_bit;
+
+	const unsigned short* SRT_table_dimensions = parameters->SRT_table_dimensions;
+	const unsigned short SRT_table_p0 = parameters->SRT_table_p0;
+	const unsigned short (*SRT_table_mappings)[3] = parameters->SRT_table_mappings;
+	const unsigned short SRT_table_mappings_count = parameters->SRT_table_mappings_count;
+
+	const unsigned short
+		iterations = parameters->iterations,
+		delta = parameters->delta,
+		mb = parameters->mb,
+		processor_size = parameters->processor_size;
+	const unsigned short register_S_size = parameters->register_S_size;
+
+	word_pointer random_seed1 = simulator->random_seed1, random_seed2 = simulator->random_seed2;
+	word_pointer A = simulator->A, B = simulator->B, S = simulator->S, S_prime = simulator->S_prime;
+
+	word_pointer
+		register_S = simulator->register_S,
+		register_A = simulator->register_A,
+		register_W = simulator->register_W,
+		register_S_practical = simulator->register_S_practical,
+		register_S_m1 = simulator->register_S_m1,
+		register_2S = simulator->register_2S,
+		register_2S_m1 = simulator->register_2S_m1;
+	struct carrysave_word register_W_practical = simulator->register_W_practical;
+#if !defined(SUPPRESS_DETAILS)
+	// (the display of the details only)
+	const unsigned short register_W_size = parameters->register_W_size;
+	word_pointer register_W_resolved = simulator->register_W_resolved;
+	word_pointer Sdot = simulator->Sdot;
+#endif
+	word_pointer P_mask = simulator->P_mask, P = simulator->P;
+
+	word_pointer
+		digit_multiplier_B = simulator->digit_multiplier_B,
+		digit_multiplier_S = simulator->digit_multiplier_S,
+		digit_multiplier_S_practical = simulator->digit_multiplier_S_practical;
+	word_pointer
+		onthefly_appended_digit = simulator->onthefly_appended_digit,
+		onthefly_appended_digit_m1 = simulator->onthefly_appended_digit_m1,
+		onthefly_appended_digit_t2 = simulator->onthefly_appended_digit_t2,
+		onthefly_appended_digit_t2m1 = simulator->onthefly_appended_digit_t2m1;
+
+	word_arena_pointer iteration_arena = simulator->iteration_arena;
+
+	// the registers keep the values left by the previous
+	// problem, if any, hence they are cleared.
+	word_pointer registers[] = {
+		A, B, S, S_prime, register_S, register_A, register_W,
+		register_S_practical, register_S_m1, register_2S, register_2S_m1,
+		register_W_practical.sum, register_W_practical.carry, P_mask, P
+	};
+	for (unsigned int i = 0; i < sizeof(registers) / sizeof(registers[0]); ++i)
+		word_clear(registers[i]);
+
+	arena_reset(iteration_arena);
+
+	simulator->failure_iteration = 0;
+
+	// compute the random operand values (the multiplier
+	// B and multiplicand A)
+	word_op_multiply(A, random_seed1, random_seed1);
+	word_op_multiply(B, random_seed2, random_seed2);
+
+	assert(!A->overflow && !A->underflow && "INCORRECT RANDOM GENERATION OF THE MULTIPLICAND A");
+	assert(!B->overflow && !B->underflow && "INCORRECT RANDOM GENERATION OF THE MULTIPLIER B");
+	if (A->overflow || A->underflow || B->overflow || B->underflow) {
+		return PROBLEM_OVERFLOWED;
+	}
+
+	// compute the exact square root
+	word_op_multiply(S, random_seed1, random_seed2);
+	assert(!S->overflow && !S->underflow && "INCORRECT RANDOM GENERATION OF THE SQUARE ROOT S");
+	if (S->overflow || S->underflow) {
+		return PROBLEM_OVERFLOWED;
+	}
+
+	char *buffer1, *buffer2, *buffer3;
+
+	if (verbose) {
+		buffer1 = word_makestring(A, 1 << algorithm_m);
+		buffer2 = word_makestring(B, 1 << algorithm_m);
+		buffer3 = word_makestring(S, 1 << algorithm_m);
+		printf("Problem data:\n"
+			   " - A : %s (size = %d bits, radix = %d)\n"
+			   " - B : %s (size = %d bits, radix = %d)\n"
+			   " - S : %s (size = %d bits, radix = %d)\n",
+			buffer1, processor_size, 1 << algorithm_m,
+			buffer2, processor_size, 1 << algorithm_m,
+			buffer3, processor_size, 1 << algorithm_m);
+
+		free(buffer1);
+		free(buffer2);
+		free(buffer3);
+	}
+
+	// Prepare the digits of the precomuputed  square root to
+	// feed them serially to the algorithm. Note that the square
+	// root produced or demanded by the algorithm is the delayed
+	// (S'), rather than the direct square root (S). The differe-
+	// nce is that S' has Z leading zero bits as compared to S.
+	word_op_load(S_prime, S, mb);
+
+	unsigned int *S_prime_digits = word_makelist_into(S_prime, algorithm_m,
+		simulator->S_prime_digits, simulator->S_prime_digits_capacity);
+
+	/*
+	assert(S_prime_digits[0] == (iterations) &&
+		   "NOT ENOUGH RESULT DIGITS PRODUCED");
+	if (S_prime_digits[0] != (iterations)) {
+		perror("NOT ENOUGH RESULT DIGITS PRODUCED");
+		return 0;
+	}
+	 */
+
+	if (verbose) {
+		printf(" - S': %s (size = %d bits)\n\n",
+			   buffer1 = word_makestring(S_prime, 1 << algorithm_m),
+			   processor_size + algorithm_Z);
+
+		free(buffer1);
+	}
+
+	// Similarly, prepare the digits of the multiplier to be
+	// consumed easily by the algorithm.
+	// (the conversion into signed digits, if any, is done
+	// once here, as B is known in full before the algorithm
+	// starts)
+	int *B_digits = (algorithm_multiplier_signed ?
+					 word_makesignedlist_into(B, algorithm_m,
+						simulator->B_digits, simulator->B_digits_capacity) :
+					 (int*) word_makelist_into(B, algorithm_m,
+						(unsigned int*) simulator->B_digits, simulator->B_digits_capacity));
+
+	// the least-significant bit position of the residual sample,
+	// known in the SRT division world as the partial shifted
+	// residual P.
+	// the minus one is to account for the case when 2P has to
+	// be passed to the table.
+	unsigned short P_cursor =
+		(algorithm_m * algorithm_n + algorithm_Z) - algorithm_np_fractional - 1;
+	// the mask needed to pass that sample out of the residual W
+	word_op_load_constant(P_mask, ~0, P_cursor,
+						  algorithm_np + 1 /* sign bit */ + 1 /* loose bit shift */);
+
 	// These two selectors on the other hand specify whether
 	// the direct value (=0) or the "minus one" variant (=1)
 	// should be used for the formation of either the direct
 	// value (select), or the "minus one" value (select_m1).
 	unsigned char onthefly_select = 0, onthefly_select_m1 = 0;
-	
+
 	// -------------------------------------
 	// initialization step of the algorithm
 	// -------------------------------------
-	
+
 	// theoretical {S'} (register_S) is correctly initialized
 	// to zero at this point.
-	
-	// Z should be greater than or equal to m, for the reason
-	// mentioned in the following comment section.
-	assert(algorithm_Z >= algorithm_m && "Z should be greater than or equal to m.");
-	if (algorithm_Z < algorithm_m) {
-		perror("Z should be greater than or equal to m.");
-		return 0;
-	}
-	
+
 	// Both {S'} (register_S_practical) and 2{S'} (register_2S)
 	// are also correctly initialized to zero. Note that since
 	// "Z" is not permitted to have a value of ZERO, we eliminate
 	// the scenario in which {S'} has to be initialized to "1"
 	// and 2{S'} has to be initialized to "10" binary (2).
-	
+	// (Z should be greater than or equal to m, see "main")
+
 	// As for keeping a correct relationship with the minus-one
 	// (*_m1) copy of both registers, this is not necessary since
-	// at iteration number floor(Z / m), a hardwired digit 
+	// at iteration number floor(Z / m), a hardwired digit
 	// selection of "1" will be made, leading into the value of
 	// the "*_m1" registers being discarded.
-	
+
 	// {A} = A
 	word_op_load(register_A, A, 0);
 	
 	// digit_multiplier_B = b1
-	word_op_load_constant(digit_multiplier_B, B_digits[1], 0, algorithm_m);
+	word_op_load_constant(digit_multiplier_B, B_digits[1], 0, algorithm_m + 2);
 	
 	// {W} = b1×A
-	word_op_multiply(register_W, digit_multiplier_B, A);
+	word_op_multiply_digit(register_W, B_digits[1], A);
 	
 	// {W}practical = b1×A
-	word_op_multiply(register_W_practical, digit_multiplier_B, A);
+	{
+		const struct word_term initial_term = {A, +1, 0, B_digits[1]};
+		word_op_compress32(&register_W_practical, &initial_term);
+	}
 
 #if !defined(SUPPRESS_DETAILS)
+	// the details of the algorithm are only displayed for a
+	// verbose problem (the buffers below are left unused, and
+	// minimal, otherwise).
+	char* delimiter = NULL;
 	
-	// display algorithm's status
-	printf("iteration 0 (initialization):\n"
-		   "{S} = %s\n"
-		   "{A} = %s\n      (overflow = %s, underflow = %s)\n"
-		   "{W} = %s\n      (overflow = %s, underflow = %s)\n\n",
-		   buffer1 = word_makestring(register_S_practical, 1 << algorithm_m),
-		   buffer2 = word_makestring(register_A, 1 << algorithm_m),
-		   register_A->overflow ? "YES" : "NO", register_A->underflow ? "YES" : "NO",
-		   buffer3 = word_makestring(register_W_practical, 1 << algorithm_m),
-		   register_W_practical->overflow ? "YES" : "NO", register_W_practical->underflow ? "YES" : "NO");
-	
-	free(buffer1);
-	free(buffer2);
-
-	char *delimiter = malloc(strlen(buffer3) + 7);
-	strncpy(delimiter, "      ", 6);
-	
-	buffer1 = delimiter + 6;
-	for (unsigned int i = 0; i < strlen(buffer3); ++i)
-		*(buffer1++) = '-';
+	if (verbose) {
+		word_carrysave_resolve(register_W_resolved, &register_W_practical);
+		
+		// display algorithm's status
+		printf("iteration 0 (initialization):\n"
+			   "{S} = %s\n"
+			   "{A} = %s\n      (overflow = %s, underflow = %s)\n"
+			   "{W} = %s\n      (overflow = %s, underflow = %s)\n\n",
+			   buffer1 = word_makestring(register_S_practical, 1 << algorithm_m),
+			   buffer2 = word_makestring(register_A, 1 << algorithm_m),
+			   register_A->overflow ? "YES" : "NO", register_A->underflow ? "YES" : "NO",
+			   buffer3 = word_makestring(register_W_resolved, 1 << algorithm_m),
+			   register_W_practical.sum->overflow ? "YES" : "NO", register_W_practical.sum->underflow ? "YES" : "NO");
+		
+		free(buffer1);
+		free(buffer2);
+		
+		delimiter = malloc(strlen(buffer3) + 7);
+		strncpy(delimiter, "      ", 6);
+		
+		buffer1 = delimiter + 6;
+		for (unsigned int i = 0; i < strlen(buffer3); ++i)
+			*(buffer1++) = '-';
+		
+		free(buffer3);
+		*buffer1 = '\0';
+	}
 	
-	free(buffer3);
-	*buffer1 = '\0';
+	// the strings displayed within the loop are written into
+	// these buffers, which are large enough for any of the
+	// words displayed there.
+	const size_t string_capacity = (verbose ? word_makestring_capacity(
+		(register_W_size > (processor_size << 1) ? register_W_size : processor_size << 1), 
+		1 << algorithm_m) : 1);
+	char string1[string_capacity], string2[string_capacity], string3[string_capacity];
 #endif
-	
+
+	// the outcome of the problem, which may be decided within
+	// the loop should the table look-up fail.
+	enum problem_outcome outcome = PROBLEM_PASSED;
+
+	// the last SRT table look-up (see "simulator->failure_
+	// iteration").
+	unsigned short looked_up_iteration = 0;
+	unsigned int looked_up_cell[2] = {0, 0};
+
 	// -------------------------------------
 	// the algorithm's loop
 	// -------------------------------------
 	for (unsigned int iteration = 1; 
 		 iteration <= iterations; ++iteration) {
 		
-		// extract the partial shifted residual P, contains both the
-		// integral and fractional parts.
-		word_op_extract(register_W_practical, P, P_cursor);
+		// the position of the truncated fractional result Sdot within
+		// the practical result register.
+		const int Sdot_cursor = 
+			((int) iteration - 1) * algorithm_m - algorithm_Z - algorithm_ns - 1 /* loose-bit */;
+		
+#if !defined(SUPPRESS_DETAILS)		
+		if (verbose) {
+			// extract the partial shifted residual P, contains both the
+			// integral and fractional parts.
+			// (the table look-up reads its fields straight from the
+			// registers, these are only needed for display)
+			word_op_extract(register_W_resolved, P, P_cursor);
 		
-		// extract the truncated fractional result Sdot
-		word_op_extract(register_S_practical, Sdot, 
-						((short) iteration - 1) * algorithm_m - algorithm_Z - algorithm_ns - 1 /* loose-bit */);
+			// extract the truncated fractional result Sdot
+			word_op_extract(register_S_practical, Sdot, Sdot_cursor);
+		}
+#endif
 
+		// the next multiplier digit bi+1 and the current delayed root
+		// digit s'i (precomputed)
+		const int digit_B = (iteration < (unsigned int) B_digits[0] ? B_digits[iteration + 1] : 0);
+		const int digit_S = (iteration <= S_prime_digits[0] ? S_prime_digits[iteration] : 0);
+		
 		// load the next multiplier digit bi+1 into "digit_multiplier_B"
-		if (iteration < B_digits[0])
-			word_op_load_constant(digit_multiplier_B, B_digits[iteration + 1], 0, algorithm_m);
-		else word_op_load_constant(digit_multiplier_B, 0, 0, algorithm_m);
+		word_op_load_constant(digit_multiplier_B, digit_B, 0, algorithm_m + 2);
 		
 		// load the current delayed root digit s'i into "digit_multiplier_S"
-		word_op_load_constant(digit_multiplier_S, 
-							  (iteration <= S_prime_digits[0] ? S_prime_digits[iteration] : 0), 0, algorithm_m);
+		word_op_load_constant(digit_multiplier_S, digit_S, 0, algorithm_m);
 		
 #if !defined(SUPPRESS_DETAILS)		
-		printf("iteration %u (", iteration);
+		if (verbose) {
+			printf("iteration %u (", iteration);
 		
-		if (iteration < B_digits[0]) {
-			// maximum supported radix has 3 decimal digits per high-radix 
-			// digit, plus a null character.
-			buffer1 = malloc(4);
-			sprintf(buffer1, "%.0f", word_approximatevalue(digit_multiplier_B));
-			
-			printf("b = %s", buffer1);
+			if (iteration < (unsigned int) B_digits[0]) {
+				// maximum supported radix has 3 decimal digits per high-radix 
+				// digit, plus a sign and a null character.
+				char digit_string[5];
+				sprintf(digit_string, "%.0f", word_approximatevalue(digit_multiplier_B));
 			
-			free(buffer1);
-		}
+				printf("b = %s", digit_string);
+			}
 		
-		if (iteration >= delta && iteration < B_digits[0])
-			printf(", ");
+			if (iteration >= delta && iteration < (unsigned int) B_digits[0])
+				printf(", ");
 		
-		if (iteration >= delta) {
-			printf("s'<precomputed> = %d", 
-				   (iteration <= S_prime_digits[0] ? S_prime_digits[iteration] : 0));
-		}
+			if (iteration >= delta) {
+				printf("s'<precomputed> = %d", 
+					   (iteration <= S_prime_digits[0] ? S_prime_digits[iteration] : 0));
+			}
 			   
-		puts("):");
+			puts("):");
 
-		register_W_practical->is_signed = 0;
-		buffer1 = word_makestring(register_W_practical, 1 << algorithm_m);
-		register_W_practical->is_signed = 1;	
+			register_W_resolved->is_signed = 0;
+			buffer1 = word_makestring_into(register_W_resolved, 1 << algorithm_m, string1, string_capacity);
+			register_W_resolved->is_signed = 1;	
 		
-		buffer2 = word_makestring(P_mask, 1 << algorithm_m);
+			buffer2 = word_makestring_into(P_mask, 1 << algorithm_m, string2, string_capacity);
 
-		printf("      %s\n", buffer1);
-		printf("(^) : %s\n", word_cleanstring(buffer2));
-		printf("%s\n", delimiter);
+			printf("      %s\n", buffer1);
+			printf("(^) : %s\n", word_cleanstring(buffer2));
+			printf("%s\n", delimiter);
 		
-		free(buffer2);
 		
-		P->is_signed = 0;
-		buffer2 = word_makestring(P, 1 << algorithm_m);
-		P->is_signed = 1;
-		buffer3 = word_makestring(P, 1 << algorithm_m);
+			P->is_signed = 0;
+			buffer2 = word_makestring_into(P, 1 << algorithm_m, string2, string_capacity);
+			P->is_signed = 1;
+			buffer3 = word_makestring_into(P, 1 << algorithm_m, string3, string_capacity);
 		
-		printf("P  = \"%s\" (%c%s)\n", buffer2, word_sign(P), buffer3);
+			printf("P  = \"%s\" (%c%s)\n", buffer2, word_sign(P), buffer3);
 		
-		free(buffer2);
-		free(buffer3);
 		
-		{
-			word_pointer temp = create_word(algorithm_ns + 1 + (algorithm_ns + 1) % algorithm_m);
-			word_op_load(temp, Sdot, 0);
+			{
+				struct small_word temp_storage;
+				word_pointer temp = create_small_word(&temp_storage, 
+					algorithm_ns + 1 + (algorithm_ns + 1) % algorithm_m);
+				word_op_load(temp, Sdot, 0);
 			
-			word_op_leftshift(temp, (algorithm_ns + 1) % algorithm_m);
+				word_op_leftshift(temp, (algorithm_ns + 1) % algorithm_m);
 			
-			buffer2 = word_makestring(temp, 1 << algorithm_m);
-			word_deallocate(temp);
-		}
-		
-		printf("S. = \"0\".\"%s\"\n\n", buffer2);
+				buffer2 = word_makestring_into(temp, 1 << algorithm_m, string2, string_capacity);
+			}
 		
-		free(buffer1);
-		free(buffer2);	
+			printf("S. = \"0\".\"%s\"\n\n", buffer2);
+		}
 #endif
 		
+		// the resulting digit of the SRT table look-up
+		short signed_digit = 0;
+		
 		// THE SRT TABLE LOOK-UP
 		{
-			// the resulting digit of the look-up
-			short signed_digit = 0;
-			
 			// First-Digit Selector: digit has to be chosen from {1,2,3}
-			if (iteration == delta) {
-				word_pointer W_sample = create_word(3);
-				word_op_extract(register_W_practical, W_sample, 
-								(algorithm_m * (algorithm_n + 1) + 2 * algorithm_Z) - 3);
+			if (iteration == delta && FIRST_DIGIT_SELECTOR == algorithm_first_digit) {
+				// (estimated from the carry-save residual, see below)
+				// upgrade: ABC is read along with the sign bit above
+				// it and a guard bit below it, as an estimate one unit
+				// too low would otherwise turn an ABC of 000 into 111.
+				// a negative sample, which only an estimate that low
+				// can give, is clamped at 000.
+				int64_t W_sample = word_carrysave_estimate(&register_W_practical,
+					(algorithm_m * (algorithm_n + 1) + 2 * algorithm_Z) - 4, 5, 1) >> 1;
+				if (W_sample < 0)
+					W_sample = 0;
 
 				// ABC = 011 or more
-				if (1 == word_op_compare_constant(W_sample, 2))
+				if (W_sample > 2)
 					signed_digit = 3;
 				// ABC = 001 or more
-				else if (1 == word_op_compare_constant(W_sample, 0))
+				else if (W_sample > 0)
 					signed_digit = 2;
 				// ABC = 000 		
 				else
 					signed_digit = 1;
 
+				// (the "cell" of the First-Digit Selector is ABC)
+				looked_up_iteration = iteration;
+				looked_up_cell[0] = (unsigned int) W_sample;
+				looked_up_cell[1] = 0;
 				
 #if !defined(SUPPRESS_DETAILS)	
-				printf("s' = FIRST-DIGIT-SELECTOR(ABC = %c%c%c) = \"%d\"\n",
-					 (BITS(W_sample)[2] ? '1' : '0'),
-					 (BITS(W_sample)[1] ? '1' : '0'),
-					 (BITS(W_sample)[0] ? '1' : '0'),
-					 (int) signed_digit);
+				if (verbose) {
+					printf("s' = FIRST-DIGIT-SELECTOR(ABC = %c%c%c) = \"%d\"\n",
+						 ((W_sample >> 2) & 1 ? '1' : '0'),
+						 ((W_sample >> 1) & 1 ? '1' : '0'),
+						 (W_sample & 1 ? '1' : '0'),
+						 (int) signed_digit);
+				}
 #endif
-				word_deallocate(W_sample);
 
-			} else if (iteration > delta) {
+			} else if (iteration == delta && FIRST_DIGIT_HARDWIRED == algorithm_first_digit) {
+
+				// here, we want the {S'} (register_S_practical/*_m1) and 
+				// {S'} - 1 (register_2S/*_m1) registers to be updated using
+				// the same mechanisms implemented in the code, suggesting
+				// that this hardwired choice will be incorporated into
+				// the SRT table in an actual implementation of the 
+				// algorithm.
+				signed_digit = 1;
+
+				looked_up_iteration = iteration;
+				looked_up_cell[0] = looked_up_cell[1] = 0;
+
+#if !defined(SUPPRESS_DETAILS)	
+				if (verbose) {
+					puts("s' = HARDWIRED ASSIGNMENT = \"1\"\n");
+				}
+#endif
+
+			// (the first digit as well, for FIRST_DIGIT_TABLE)
+			} else if (iteration >= delta) {
 				
 				// the signed value of P
 				int Pregion = 0;
@@ -534,19 +863,22 @@ int main (int argc, const char * argv[]) {
 				
 				// The loose-bit signal, used to determine whether S/P or
 				// 2S/2P need to be passed to the table.
-				unsigned char loose_bit_signal = BITS(Sdot)[algorithm_ns];
+				// (it is the most-significant bit of Sdot, and taken as
+				// set when the table ignores it)
+				const unsigned char loose_bit_signal = (unsigned char) (!algorithm_loose_bit ||
+					word_extract_bits(register_S_practical, Sdot_cursor + algorithm_ns, 1, 0));
 				
 				// (loose-bit signal is 1, means Sdot = 0.1XXXX)
 				//		in this case, we sample the 2nd to the ns'th fractional position
 				// (loose-bit signal is 0, means Sdot = 0.01XXXX)
 				//		in this case, we sample the 3rd to the (ns+1)'th fractional position				
-				for (int i = algorithm_ns - 1 - (1 - loose_bit_signal); i >= loose_bit_signal; --i) {
-					Sregion_index <<= 1;
-					Sregion_index += BITS(Sdot)[i];
-				}
+				// (that is, ns - 1 bits of Sdot starting from the loose-bit 
+				// signal position)
+				Sregion_index = (unsigned int) word_extract_bits(register_S_practical, 
+					Sdot_cursor + loose_bit_signal, algorithm_ns - 1, 0);
 				
 				// the translation needed when initialroot is 0
-//				if (0 == algorithm_initialroot) ++Sregion_index;
+				if (0 == algorithm_initialroot) ++Sregion_index;
 				
 				// calculation of the P region (not yet the index)
 				// note that P is (np + 1) bits long, where the most-sig-
@@ -554,19 +886,25 @@ int main (int argc, const char * argv[]) {
 				// amplitude bits.
 				// upgrade: now P is (np + 2) bits long, to include an
 				// extra bit for the loose-bit shifting.
-				for (int i = algorithm_np + loose_bit_signal; i >= loose_bit_signal; --i) {
-					Pregion <<= 1;
-					
-					// The most-significant bit is the sign bit
-					if (i == algorithm_np + loose_bit_signal)
-						Pregion -= BITS(P)[i];
-					else Pregion += BITS(P)[i]; 
-				}
+				// (the np + 1 bits starting from the loose-bit signal
+				// position are read as a signed field)
+				// upgrade: the residual may now be in a carry-save format,
+				// so these bits are estimated by a short carry-propagate
+				// adder over the same bits of the sum and carry words,
+				// which may read P one unit too low (the estimate is 
+				// exact otherwise, as the carry word stays at zero).
+				Pregion = (int) word_carrysave_estimate(&register_W_practical, 
+					P_cursor + loose_bit_signal, algorithm_np + 1, 1);
 				
 				// for symmetric-table implementations
+				// upgrade: with a carry-save residual, a negative P is
+				// mirrored through its ones' complement (-P - 1), so
+				// that an estimate one unit too low errs the same way
+				// on both sides of the table (one row closer to zero
+				// at most), whereas its negation errs a row further
+				// away from zero for a negative P.
 				if (algorithm_table_unsigned && Pregion < 0) {
-					//Pregion = ~Pregion;
-					Pregion = -Pregion;
+					Pregion = (algorithm_residual_carrysave ? ~Pregion : -Pregion);
 					was_inverted = 1;
 				}
 				
@@ -583,43 +921,51 @@ int main (int argc, const char * argv[]) {
 					}
 				}
 				
-				assert(Pregion_index < SRT_table_dimensions[0] && 
-					   Sregion_index < SRT_table_dimensions[1] && 
-					   "SRT table indexing problem (indices out of range).");
+				looked_up_iteration = iteration;
+				looked_up_cell[0] = Pregion_index;
+				looked_up_cell[1] = Sregion_index;
+				
+				// (a failure of the table is an outcome of the problem,
+				// rather than an error of the simulator, hence it ends
+				// the problem instead of being asserted)
 				if (Pregion_index >= SRT_table_dimensions[0] || 
 					Sregion_index >= SRT_table_dimensions[1]) {
-					perror("SRT table is not being indexed correctly "
-						   "(one of the indices or both are out of range).");
-					return 0;
+					if (verbose)
+						perror("SRT table is not being indexed correctly "
+							   "(one of the indices or both are out of range).");
+					outcome = PROBLEM_TABLE_FAILURE;
+					break;
 				}
 				
 				// The actual look up
-				signed_digit = SRT_table[Pregion_index][Sregion_index];
+				signed_digit = srt_table_cell(parameters, Pregion_index, Sregion_index);
 				
 				// for symmetric-table implementations
 				if (algorithm_table_unsigned && was_inverted) {
 					signed_digit = -signed_digit;
 				}
 				
-				assert(signed_digit >= -algorithm_alpha && 
-					   signed_digit <= +algorithm_beta &&
-					   "Forbidden cells of the SRT table are being invoked "
-					   "by the SRT table look-up mechanism!");
 				if (signed_digit < -algorithm_alpha ||
 					signed_digit > +algorithm_beta) {
-					perror("Access to forbidden areas of the SRT table was detected.");
-					return 0;
+					if (verbose)
+						perror("Access to forbidden areas of the SRT table was detected.");
+					outcome = PROBLEM_TABLE_FAILURE;
+					break;
 				}
 				
 #if !defined(SUPPRESS_DETAILS)	
-				printf("loose-bit signal = %s\n\n", 
-					   loose_bit_signal ? "1" : "0");				
-				printf("s' = SRTLookUp[%u][%u] = %d\n\n", 
-					   Pregion_index, Sregion_index, signed_digit);
+				if (verbose) {
+					printf("loose-bit signal = %s\n\n", 
+						   loose_bit_signal ? "1" : "0");				
+					printf("s' = SRTLookUp[%u][%u] = %d\n\n", 
+						   Pregion_index, Sregion_index, signed_digit);
+				}
 #endif
 			} else {
 #if !defined(SUPPRESS_DETAILS)	
-				printf("s' = 0\n\n");
+				if (verbose) {
+					printf("s' = 0\n\n");
+				}
 #endif
 			}
 	
@@ -673,176 +1019,183 @@ int main (int argc, const char * argv[]) {
 		// formation of the [2{S'}|s'] value on the fly, which will be 
 		// referred to as the S0s value (knowing that it can be written
 		// as [S'|0|s']).
-		word_pointer S0s = create_word(algorithm_m * (algorithm_n + 1));
+		word_pointer S0s = create_word_in(iteration_arena, algorithm_m * (algorithm_n + 1));
 		word_op_load(S0s, (0 == onthefly_select ? 
 						   register_2S : register_2S_m1), algorithm_m);
 		word_op_load(S0s, onthefly_appended_digit, 0);
 		
+		// the same value in the theoretical case, formed out of {S}
+		// and the precomputed digit s'.
+		word_pointer S0s_theoretical = 
+			create_word_in(iteration_arena, register_S_size + algorithm_m + 1);
+		word_op_load(S0s_theoretical, register_S, algorithm_m + 1);
+		word_op_load_constant(S0s_theoretical, digit_S, 0, algorithm_m);
+		
 		// Definition of both the partial-product (+) and the linear-
-		// quadratic (-) terms.
-		word_pointer partial_product_term = create_word(register_W_size);
-		word_pointer linearquadratic_term = create_word(register_W_size);
-		word_pointer linearquadratic_term_practical = create_word(register_W_size);	
+		// quadratic (-) terms, which are the products of a digit with
+		// a word, shifted into their position within the residual.
+		// (the products are formed on their way into the residual, 
+		// there are no words holding the terms themselves)
+		const unsigned short partial_product_offset = algorithm_m;
+		const unsigned short linearquadratic_offset = 
+			algorithm_m * (algorithm_n + 1) + 2 * algorithm_Z;
 		
+		// partial product: bi+1 × A, linear-quadratic: s' × [S|0|s'].
 		// unlike the linear-quadratic term in the theoretical case, 
-		// the practical version has to be signed as it contains the
-		// result of multiplying the (now signed) result digit with
-		// the S0s word.
-		linearquadratic_term_practical->is_signed = 1;
-		
-		// construct the partial product term
-		word_op_multiply(partial_product_term, digit_multiplier_B, register_A);
-		word_op_leftshift(partial_product_term, algorithm_m);
-		
-		// construct the linear-quadratic term
-		word_op_load(linearquadratic_term, register_S, algorithm_m + 1);
-		word_op_load_constant(linearquadratic_term, (iteration <= S_prime_digits[0] ? 
-													 S_prime_digits[iteration] : 0), 0, algorithm_m);
-		word_op_multiply(linearquadratic_term, digit_multiplier_S, linearquadratic_term);
-		word_op_leftshift(linearquadratic_term, algorithm_m * (algorithm_n + 1) + 2 * algorithm_Z);
-
-		// construct the practical linear-quadratic term
-		word_op_multiply(linearquadratic_term_practical, 
-						 digit_multiplier_S_practical, S0s);
-		word_op_leftshift(linearquadratic_term_practical, 
-						  algorithm_m * (algorithm_n + 1) + 2 * algorithm_Z);
+		// the practical version is signed as it uses the (now signed)
+		// result digit.
+		const struct word_term terms[2] = {
+			{register_A, +1, partial_product_offset, digit_B},
+			{S0s_theoretical, -1, linearquadratic_offset, digit_S}
+		};
+		const struct word_term terms_practical[2] = {
+			{register_A, +1, partial_product_offset, digit_B},
+			{S0s, -1, linearquadratic_offset, signed_digit}
+		};
 	
 #if !defined(SUPPRESS_DETAILS)	
+		if (verbose) {
+			buffer1 = word_makestring_into(S0s, 1 << algorithm_m, string1, string_capacity);
+			buffer2 = word_makestring_into(digit_multiplier_S_practical, 1 << algorithm_m, string2, string_capacity);
+			buffer3 = word_makestring_into(register_2S, 1 << algorithm_m, string3, string_capacity);
 		
-		buffer1 = word_makestring(S0s, 1 << algorithm_m);
-		buffer2 = word_makestring(digit_multiplier_S_practical, 1 << algorithm_m);
-		buffer3 = word_makestring(register_2S, 1 << algorithm_m);
-		
-		//printf("// %c%s × %s (%s|%s)\n",
-		//	   word_sign(digit_multiplier_S_practical), buffer2, buffer1,
-		//	   buffer3, buffer2);
+			//printf("// %c%s × %s (%s|%s)\n",
+			//	   word_sign(digit_multiplier_S_practical), buffer2, buffer1,
+			//	   buffer3, buffer2);
 		
-		free(buffer1);
-		free(buffer2);
-		free(buffer3);
 		
-		// display both terms
-		buffer1 = word_makestring(partial_product_term, 1 << algorithm_m);
-		linearquadratic_term_practical->is_signed = 0;
-		buffer2 = word_makestring(linearquadratic_term_practical, 1 << algorithm_m);
-		linearquadratic_term_practical->is_signed = 1;	
+			// display both terms, accumulated into words of their own
+			{
+				word_pointer displayed_term = create_word_in(iteration_arena, register_W_size);
+				displayed_term->is_signed = 1;
+				word_op_mac(displayed_term, digit_B, register_A, partial_product_offset, +1);
+				displayed_term->is_signed = 0;
+				buffer1 = word_makestring_into(displayed_term, 1 << algorithm_m, string1, string_capacity);
+			
+				displayed_term = create_word_in(iteration_arena, register_W_size);
+				displayed_term->is_signed = 1;
+				word_op_mac(displayed_term, signed_digit, S0s, linearquadratic_offset, +1);
+				displayed_term->is_signed = 0;
+				buffer2 = word_makestring_into(displayed_term, 1 << algorithm_m, string2, string_capacity);
+			}
 		
-		register_W_practical->is_signed = 0;
-		buffer3 = word_makestring(register_W_practical, 1 << algorithm_m);
-		register_W_practical->is_signed = 1;
+			register_W_resolved->is_signed = 0;
+			buffer3 = word_makestring_into(register_W_resolved, 1 << algorithm_m, string3, string_capacity);
+			register_W_resolved->is_signed = 1;
 
-		printf("      %s\n", buffer3);
+			printf("      %s\n", buffer3);
 		
-		// display the terms with proper alignment and clean display, 
-		// eliminating unnecessary zeros
-		{
-			size_t W_string_size = strlen(buffer3);
-			char buffer4[64] = {0};
+			// display the terms with proper alignment and clean display, 
+			// eliminating unnecessary zeros
+			{
+				size_t W_string_size = strlen(buffer3);
+				char buffer4[64] = {0};
 			
-			sprintf(buffer4, "( ) : %%%ds\n", (int) W_string_size - 1);
+				sprintf(buffer4, "( ) : %%%ds\n", (int) W_string_size - 1);
 
-			if (iteration < B_digits[0]) {
-				buffer4[1] = '+';
-				printf(buffer4, word_cleanstring(buffer1));
-			}
+				if (iteration < (unsigned int) B_digits[0]) {
+					buffer4[1] = '+';
+					printf(buffer4, word_cleanstring(buffer1));
+				}
 			
-			if (iteration >= delta) {
-				buffer4[1] = '-';
-				printf(buffer4, word_cleanstring(buffer2));
+				if (iteration >= delta) {
+					buffer4[1] = '-';
+					printf(buffer4, word_cleanstring(buffer2));
+				}
 			}
 		}
-		
-		free(buffer1);
-		free(buffer2);
-		free(buffer3);				
 #endif
 		
 		// now use both terms to update the residual word
 		
-		// update the residual register {W}
-		word_op_leftshift(register_W, algorithm_m * 2);
-		
-		// update the practical residual register {W}
-		word_op_leftshift(register_W_practical, algorithm_m * 2);
-				
-		word_op_add(register_W, partial_product_term, +1, 0);
-		word_op_add(register_W_practical, partial_product_term, +1, 0);
-		
 #if !defined(SUPPRESS_DETAILS)		
-		register_W_practical->is_signed = 0;
-		buffer1 = word_makestring(register_W_practical, 1 << algorithm_m);
-		register_W_practical->is_signed = 1;				
+		if (verbose) {
+			// the practical residual with only the partial product
+			// term added.
+			{
+				word_pointer partial_W = create_word_in(iteration_arena, register_W_size);
+				partial_W->is_signed = 1;
+				word_op_add(partial_W, register_W_resolved, +1, 0);
+				word_op_shift_accumulate(partial_W, algorithm_m * 2, terms_practical, 1);
+				partial_W->is_signed = 0;
+				buffer1 = word_makestring_into(partial_W, 1 << algorithm_m, string1, string_capacity);
+			}
+		}
 #endif
 		
-		word_op_add(register_W, linearquadratic_term, -1, 0);
-		word_op_add(register_W_practical, linearquadratic_term_practical, -1, 0);	
+		// update the residual register {W}, shifting it and adding
+		// both terms in one go
+		word_op_shift_accumulate(register_W, algorithm_m * 2, terms, 2);
+		
+		// update the practical residual register {W}, which takes
+		// both terms through a 4:2 compressor
+		if (algorithm_residual_carrysave)
+			word_op_carrysave_accumulate(&register_W_practical, algorithm_m * 2, terms_practical, 2);
+		else
+			word_op_shift_accumulate(register_W_practical.sum, algorithm_m * 2, terms_practical, 2);
 		
 #if !defined(SUPPRESS_DETAILS)		
-		register_W_practical->is_signed = 0;
-		buffer2 = word_makestring(register_W_practical, 1 << algorithm_m);
-		register_W_practical->is_signed = 1;
+if (verbose) {
+			word_carrysave_resolve(register_W_resolved, &register_W_practical);
 		
-		{
-			word_pointer B_effective = create_word_duplicate(B);
-			word_pointer result_squared = create_word(processor_size << 1);			
+			register_W_resolved->is_signed = 0;
+			buffer2 = word_makestring_into(register_W_resolved, 1 << algorithm_m, string2, string_capacity);
+			register_W_resolved->is_signed = 1;
+		
+			{
+				word_pointer B_effective = create_word_in(iteration_arena, B->length);
+				B_effective->is_signed = B->is_signed;
+				word_op_load(B_effective, B, 0);
+				word_pointer result_squared = create_word_in(iteration_arena, processor_size << 1);			
 			
-			word_pointer register_W_correct = create_word(register_W_size);
-			register_W_correct->is_signed = 1;
+				word_pointer register_W_correct = create_word_in(iteration_arena, register_W_size);
+				register_W_correct->is_signed = 1;
 
-			for (unsigned int i = 0; i < B_effective->length - iteration; ++i) {
-				BITS(B_effective)[i] = 0;
-			}
-			word_op_multiply(register_W_correct, B_effective, A);
-			
-			word_op_load(result_squared, register_S, 
-						 (processor_size + algorithm_Z) - algorithm_m * (iteration - 1));
-			word_op_multiply(result_squared, result_squared, result_squared);
-			
-			word_op_add(register_W_correct, result_squared, -1, 0);
+				for (unsigned int i = 0; i < B_effective->length - iteration; ++i) {
+					word_setbit(B_effective, i, 0);
+				}
+				word_op_multiply(register_W_correct, B_effective, A);
 			
-			//word_op_rightshift(register_W_correct, 
-			//				   -(algorithm_m * (algorithm_n + 1) + 2 * algorithm_Z));
+				word_op_load(result_squared, register_S, 
+							 (processor_size + algorithm_Z) - algorithm_m * (iteration - 1));
+				word_op_multiply(result_squared, result_squared, result_squared);
 			
-			register_W_correct->is_signed = 0;
-			buffer3 = word_makestring(result_squared, 1 << algorithm_m);
-			register_W_correct->is_signed = 1;
+				word_op_add(register_W_correct, result_squared, -1, 0);
 			
-			free(B_effective);
-			free(result_squared);
-			free(register_W_correct);
-		}
-		
-		printf("%s\n", delimiter);
-		if (iteration < B_digits[0]) {
-			printf("{W} = %s\n", buffer1);
-		}
+				//word_op_rightshift(register_W_correct, 
+				//				   -(algorithm_m * (algorithm_n + 1) + 2 * algorithm_Z));
+			
+				register_W_correct->is_signed = 0;
+				buffer3 = word_makestring_into(result_squared, 1 << algorithm_m, string3, string_capacity);
+				register_W_correct->is_signed = 1;
+			}
 		
-		if (iteration >= delta) {
-			printf("{W} = %s\n", buffer2);
-			//printf(" ---- %s\n", buffer3);
-		}
+			printf("%s\n", delimiter);
+			if (iteration < (unsigned int) B_digits[0]) {
+				printf("{W} = %s\n", buffer1);
+			}
 		
-		printf("      (overflow = %s, underflow = %s)\n\n",
-   			   register_W_practical->overflow ? "YES" : "NO", register_W_practical->underflow ? "YES" : "NO");
+			if (iteration >= delta) {
+				printf("{W} = %s\n", buffer2);
+				//printf(" ---- %s\n", buffer3);
+			}
 		
-		free(buffer1);
-		free(buffer2);	
+			printf("      (overflow = %s, underflow = %s)\n\n",
+	   			   register_W_practical.sum->overflow ? "YES" : "NO", register_W_practical.sum->underflow ? "YES" : "NO");
 		
-		register_W->is_signed = 0;
-		buffer2 = word_makestring(register_W, 1 << algorithm_m);
-		register_W->is_signed = 1;
 		
-		printf("{W}t= %s\n", buffer2);
-		printf("      (overflow = %s, underflow = %s)\n\n",
-   			   register_W->overflow ? "YES" : "NO", register_W->underflow ? "YES" : "NO");
+			register_W->is_signed = 0;
+			buffer2 = word_makestring_into(register_W, 1 << algorithm_m, string2, string_capacity);
+			register_W->is_signed = 1;
 		
-		free(buffer2);
+			printf("{W}t= %s\n", buffer2);
+			printf("      (overflow = %s, underflow = %s)\n\n",
+	   			   register_W->overflow ? "YES" : "NO", register_W->underflow ? "YES" : "NO");
+}
 #endif
 		
-		word_deallocate(S0s);
-		word_deallocate(partial_product_term);
-		word_deallocate(linearquadratic_term);
-		word_deallocate(linearquadratic_term_practical);		
+		// release S0s and the other temporaries all at once.
+		arena_reset(iteration_arena);
 		
 		// ---------------------------------
 		
@@ -884,13 +1237,35 @@ int main (int argc, const char * argv[]) {
 		word_op_load(register_2S, onthefly_appended_digit_t2, 0);
 		word_op_load(register_2S_m1, onthefly_appended_digit_t2m1, 0);				
 
+		// find the first look-up after which the practical result 
+		// can no longer converge: the digits still to come add less
+		// than a unit (of the last digit) to the theoretical result,
+		// and strictly less than alpha / (2^m - 1) (beta / (2^m - 1))
+		// units to the practical one, as there are finitely many of
+		// them, so the difference of the two results should stay 
+		// within (-alpha / (2^m - 1) - 1, +beta / (2^m - 1)) units.
+		// (the difference is taken out of the low limbs of both
+		// registers, which is exact for any difference in reach)
+		if (0 == simulator->failure_iteration && iteration >= delta) {
+			const int64_t difference = (int64_t) 
+				(word_readlimb(register_S, 0) - word_readlimb(register_S_practical, 0));
+			const int64_t digit_span = (1 << algorithm_m) - 1;
+			
+			if (difference * digit_span >= algorithm_beta ||
+				(difference + 1) * digit_span <= -algorithm_alpha) {
+				simulator->failure_iteration = iteration;
+				simulator->failure_cell[0] = looked_up_cell[0];
+				simulator->failure_cell[1] = looked_up_cell[1];
+			}
+		}
+
 #if !defined(SUPPRESS_DETAILS)		
-		// display updated result register -practical
-		printf("{S}ac = %s\n", buffer1 = word_makestring(register_S_practical, 1 << algorithm_m));
-		free(buffer1);
-		// display updated result register -theoretical
-		printf("{S}th = %s\n", buffer1 = word_makestring(register_S, 1 << algorithm_m));
-		free(buffer1);
+		if (verbose) {
+			// display updated result register -practical
+			printf("{S}ac = %s\n", buffer1 = word_makestring_into(register_S_practical, 1 << algorithm_m, string1, string_capacity));
+			// display updated result register -theoretical
+			printf("{S}th = %s\n", buffer1 = word_makestring_into(register_S, 1 << algorithm_m, string1, string_capacity));
+		}
 #endif
 		
 		if (iteration < iterations) {
@@ -898,14 +1273,17 @@ int main (int argc, const char * argv[]) {
 			word_op_leftshift(register_A, algorithm_m);
 
 #if !defined(SUPPRESS_DETAILS)
-			printf("{A} = %s\n\n", buffer1 = word_makestring(register_A, 1 << algorithm_m));
-			free(buffer1);
+			if (verbose) {
+				printf("{A} = %s\n\n", buffer1 = word_makestring_into(register_A, 1 << algorithm_m, string1, string_capacity));
+			}
 #endif
 			
 		} else {
 			
 #if !defined(SUPPRESS_DETAILS)			
-			printf("\n");
+			if (verbose) {
+				printf("\n");
+			}
 #endif
 			
 		}
@@ -915,78 +1293,863 @@ int main (int argc, const char * argv[]) {
 		P_cursor += algorithm_m;
 
 	}
+
+	if (PROBLEM_TABLE_FAILURE == outcome) {
+		if (0 == simulator->failure_iteration) {
+			simulator->failure_iteration = looked_up_iteration;
+			simulator->failure_cell[0] = looked_up_cell[0];
+			simulator->failure_cell[1] = looked_up_cell[1];
+		}
+		
+		if (verbose)
+			printf("~~ PROBLEM FAILED (%s) ~~\n", problem_outcome_names[outcome]);
+
+#if !defined(SUPPRESS_DETAILS)
+		free(delimiter);
+#endif
+		return outcome;
+	}
+
+	// -------------------------------------
+	// check the outcome of the problem
+	// -------------------------------------
+	// (the practical result is checked against the theoretical
+	// one, which is as good as checking the practical residual)
+	if (register_W->overflow || register_W_practical.sum->overflow ||
+		register_W->underflow || register_W_practical.sum->underflow)
+		outcome = PROBLEM_OVERFLOWED;
+	else if (0 != word_op_compare_constant(register_W, 0) ||
+			 0 != word_op_compare(register_S_practical, register_S))
+		outcome = PROBLEM_DIVERGED;
+
+	if (PROBLEM_PASSED == outcome)
+		simulator->failure_iteration = 0;
+	else if (0 == simulator->failure_iteration) {
+		simulator->failure_iteration = looked_up_iteration;
+		simulator->failure_cell[0] = looked_up_cell[0];
+		simulator->failure_cell[1] = looked_up_cell[1];
+	}
+
 	// -------------------------------------
 	// display/postprocess results
 	// -------------------------------------
-	if (0 == word_op_compare_constant(register_W, 0))
-		printf("RESIDUAL SUCCESSFULLY ELIMINATED!\n");
+	if (verbose) {
+		// (the outcome accounts for both the theoretical and the
+		// practical residuals and results, as in a batch)
+		if (PROBLEM_PASSED == outcome)
+			printf("RESIDUAL SUCCESSFULLY ELIMINATED!\n");
+		else
+			printf("~~ PROBLEM FAILED (%s) ~~\n", problem_outcome_names[outcome]);
+
+		if (register_W->overflow || register_W->underflow)
+			printf("~~ WARNING: OVERFLOW OCCURED ~~\n");
+		if (register_W_practical.sum->overflow || register_W_practical.sum->underflow)
+			printf("~~ WARNING: OVERFLOW OCCURED (practical residual) ~~\n");
+		if (0 != word_op_compare(register_S_practical, register_S))
+			printf("~~ WARNING: PRACTICAL RESULT DIFFERS FROM THE THEORETICAL ONE ~~\n");
+
+
+		word_op_rightshift(register_S, mb);
+		if (0 == word_op_compare(register_S, S))
+			printf("SQUARE ROOT CORRECTLY RECOVERED!\n");
+		else {
+			//printf("~~ WARNING: SQUARE ROOT INCORRECTLY RECOVERED ~~\n\n");
+
+			printf("{S}final = %s\n(S = %s)\n",
+				   buffer1 = word_makestring(register_S, 1 << algorithm_m),
+				   buffer2 = word_makestring(S, 1 << algorithm_m));
+
+			free(buffer1);
+			free(buffer2);
+		}
+
+		word_pointer AB = create_word_in(iteration_arena, processor_size << 1);
+		word_op_multiply(AB, B, A);
+
+		if (PROBLEM_PASSED != outcome) {
+			printf("\nEXTRA INFORMATION FOR TRACKING THE PROBLEM:"
+				   "\nAB(calculated) = %s\nS(mathematica) = BaseForm[Sqrt[%s * %s],%d]\n",
+				   buffer1 = word_makestring(AB, 1 << algorithm_m),
+				   buffer2 = word_makemathematicacode(A),
+				   buffer3 = word_makemathematicacode(B), 1 << algorithm_m);
+
+			free(buffer1);
+			free(buffer2);
+			free(buffer3);
+		}
+
+		arena_reset(iteration_arena);
+	}
+
+#if !defined(SUPPRESS_DETAILS)
+	free(delimiter);
+#endif
+
+	return outcome;
+}
+
+// --------------------------------------------------
+// problem_failure
+// --------------------------------------------------
+//   a failing problem of a batch: its seeds (as strings
+//   to the radix 2^m), its outcome and the SRT table
+//   look-up to blame (see "simulate_problem").
+// --------------------------------------------------
+struct problem_failure {
+	char* seeds[2];
+	enum problem_outcome outcome;
+	unsigned short iteration;
+	unsigned int cell[2];
+};
+
+// --------------------------------------------------
+// batch_report
+// --------------------------------------------------
+//   the outcome counters of (a part of) a batch of
+//   problems, along with its failing problems.
+// --------------------------------------------------
+struct batch_report {
+	unsigned long long outcome_counts[PROBLEM_OUTCOMES];
+	struct problem_failure* failures;
+	unsigned int failure_count, failure_capacity;
+};
+
+// --------------------------------------------------
+// batch_report_reserve
+// --------------------------------------------------
+//   makes room for "count" more failing problems in
+//   "report", and returns -1 if it runs out of memory.
+// --------------------------------------------------
+char batch_report_reserve(struct batch_report* report, unsigned int count) {
+
+	if (report->failure_count + count <= report->failure_capacity)
+		return 0;
+
+	unsigned int capacity = (report->failure_capacity ? report->failure_capacity : 16);
+	while (capacity < report->failure_count + count)
+		capacity <<= 1;
+
+	struct problem_failure* failures =
+		realloc(report->failures, sizeof(struct problem_failure) * capacity);
+
+	assert(NULL != failures);
+	if (NULL == failures) {
+		perror("Couldn't allocate memory for the failing problems of a batch.");
+		return -1;
+	}
+
+	report->failures = failures;
+	report->failure_capacity = capacity;
+	return 0;
+}
+
+// --------------------------------------------------
+// batch_report_add
+// --------------------------------------------------
+//   counts "outcome", the outcome of the last problem
+//   run by "simulator", into "report", along with the
+//   problem itself if it failed. returns -1 if it runs
+//   out of memory.
+// --------------------------------------------------
+char batch_report_add(struct batch_report* report, struct simulator* simulator,
+					  enum problem_outcome outcome) {
+
+	++report->outcome_counts[outcome];
+
+	if (PROBLEM_PASSED == outcome)
+		return 0;
+
+	if (-1 == batch_report_reserve(report, 1))
+		return -1;
+
+	const unsigned short radix = 1 << simulator->parameters->algorithm_m;
+	struct problem_failure* failure = &report->failures[report->failure_count++];
+
+	failure->seeds[0] = word_makestring(simulator->random_seed1, radix);
+	failure->seeds[1] = word_makestring(simulator->random_seed2, radix);
+	failure->outcome = outcome;
+	failure->iteration = simulator->failure_iteration;
+	failure->cell[0] = simulator->failure_cell[0];
+	failure->cell[1] = simulator->failure_cell[1];
+
+	return 0;
+}
+
+// --------------------------------------------------
+// batch_report_merge
+// --------------------------------------------------
+//   adds the counters of "part" to those of "report",
+//   and moves the failing problems of "part" over to
+//   "report". returns -1 if it runs out of memory.
+// --------------------------------------------------
+char batch_report_merge(struct batch_report* report, struct batch_report* part) {
+
+	for (unsigned int i = 0; i < PROBLEM_OUTCOMES; ++i)
+		report->outcome_counts[i] += part->outcome_counts[i];
+
+	if (0 == part->failure_count)
+		return 0;
+
+	if (-1 == batch_report_reserve(report, part->failure_count))
+		return -1;
+
+	memcpy(report->failures + report->failure_count, part->failures,
+		   sizeof(struct problem_failure) * part->failure_count);
+	report->failure_count += part->failure_count;
+	part->failure_count = 0;
+
+	return 0;
+}
+
+// --------------------------------------------------
+// batch_report_print_failure
+// --------------------------------------------------
+//   displays "failure", a failing problem of a batch run
+//   under "parameters".
+// --------------------------------------------------
+void batch_report_print_failure(const struct problem_failure* failure,
+								const struct system_parameters* parameters) {
+
+	printf("FAILED (%s): seed1 = %s, seed2 = %s (radix = %d), ",
+		   problem_outcome_names[failure->outcome],
+		   failure->seeds[0], failure->seeds[1], 1 << parameters->algorithm_m);
+
+	if (failure->iteration == parameters->delta &&
+		FIRST_DIGIT_SELECTOR == parameters->algorithm_first_digit)
+		printf("iteration %u: FIRST-DIGIT-SELECTOR(ABC = %u)\n",
+			   failure->iteration, failure->cell[0]);
+	else if (failure->iteration == parameters->delta &&
+			 FIRST_DIGIT_HARDWIRED == parameters->algorithm_first_digit)
+		printf("iteration %u: HARDWIRED ASSIGNMENT\n", failure->iteration);
 	else
-		printf("~~ RESIDUAL DIVERGED ~~\n");
+		printf("iteration %u: SRTLookUp[%u][%u]\n",
+			   failure->iteration, failure->cell[0], failure->cell[1]);
+}
 
-	if (register_W->overflow || register_W->underflow)
-		printf("~~ WARNING: OVERFLOW OCCURED ~~\n");
-		
-	
-	word_op_rightshift(register_S, mb);
-	if (0 == word_op_compare(register_S, S))
-		printf("SQUARE ROOT CORRECTLY RECOVERED!\n");
-	else {
-		//printf("~~ WARNING: SQUARE ROOT INCORRECTLY RECOVERED ~~\n\n");
-	
-		printf("{S}final = %s\n(S = %s)\n",
-			   buffer1 = word_makestring(register_S, 1 << algorithm_m),
-			   buffer2 = word_makestring(S, 1 << algorithm_m));
-	
-		free(buffer1);
-		free(buffer2);
+// --------------------------------------------------
+// batch_report_deallocate
+// --------------------------------------------------
+void batch_report_deallocate(struct batch_report* report) {
+
+	for (unsigned int i = 0; i < report->failure_count; ++i) {
+		free(report->failures[i].seeds[0]);
+		free(report->failures[i].seeds[1]);
+	}
+
+	free(report->failures);
+}
+
+// --------------------------------------------------
+// batch_worker
+// --------------------------------------------------
+//   a thread running the problems of a batch, which
+//   owns a simulator (hence a word arena), a random
+//   generator and a report, so that it shares nothing
+//   with the other workers but the work queues.
+//
+// notes:
+// - the problems of an exhaustive batch are numbered
+//   (see "run_exhaustive"), the work queues hold their
+//   numbers minus "first_problem".
+// --------------------------------------------------
+struct batch_worker {
+	pthread_t thread;
+	unsigned int index, worker_count;
+	struct work_queue* queues;
+	unsigned char exhaustive;
+	unsigned long long first_problem;
+
+	struct simulator simulator;
+	struct random_generator generator;
+	struct batch_report report;
+	// set if the report of the worker ran out of memory
+	char failed;
+	// pads the worker to whole cache lines, so that the
+	// counters of two workers never share a line.
+} __attribute__((aligned(64)));
+
+// --------------------------------------------------
+// batch_worker_run
+// --------------------------------------------------
+void* batch_worker_run(void* argument) {
+
+	struct batch_worker* worker = (struct batch_worker*) argument;
+
+	// the number of seeds with their leading bits set, and
+	// the first of them.
+	const unsigned short leading_ones = seed_leading_ones(worker->simulator.parameters);
+	const uint64_t seed_count = (uint64_t) 1 << (worker->simulator.random_seed1->length - leading_ones);
+	const uint64_t first_seed = (((uint64_t) 1 << leading_ones) - 1) * seed_count;
+
+	unsigned long long begin, end;
+	while (0 != work_next(worker->queues, worker->worker_count, worker->index, &begin, &end)) {
+		for (unsigned long long problem = begin; problem < end; ++problem) {
+			if (worker->exhaustive) {
+				const unsigned long long number = worker->first_problem + problem;
+				simulator_load_seeds(&worker->simulator, 
+					(uint32_t) (first_seed + number / seed_count),
+					(uint32_t) (first_seed + number % seed_count));
+			} else
+				simulator_randomize(&worker->simulator);
+
+			const enum problem_outcome outcome = simulate_problem(&worker->simulator, 0);
+
+			if (-1 == batch_report_add(&worker->report, &worker->simulator, outcome))
+				worker->failed = 1;
+		}
+	}
+
+	return NULL;
+}
+
+// --------------------------------------------------
+// run_batch
+// --------------------------------------------------
+//   runs "problem_count" random problems under
+//   "parameters" on "thread_count" threads, which share
+//   the problems through work stealing, and adds their
+//   outcomes to "report". returns -1 on failure.
+//   if "exhaustive" is set, the problems are the ones
+//   numbered from "first_problem" on instead (see 
+//   "run_exhaustive").
+//
+// notes:
+// - the generators of the workers are seeded out of the
+//   global one of "rand", so "initialize_randomizer"
+//   should have been called.
+// --------------------------------------------------
+char run_batch(const struct system_parameters* parameters, unsigned char exhaustive,
+			   unsigned long long first_problem, unsigned long long problem_count,
+			   unsigned int thread_count, struct batch_report* report) {
+
+	struct batch_worker* workers = NULL;
+	struct work_queue* queues = NULL;
+
+	if (0 != posix_memalign((void**) &workers, 64, sizeof(struct batch_worker) * thread_count) ||
+		0 != posix_memalign((void**) &queues, 64, sizeof(struct work_queue) * thread_count)) {
+		perror("Couldn't allocate memory for the workers of a batch.");
+		free(workers);
+		return -1;
+	}
+
+	memset((void*) workers, 0, sizeof(struct batch_worker) * thread_count);
+	initialize_work_queues(queues, thread_count, problem_count);
+
+	// every worker draws its seeds out of a stream of its own,
+	// all the streams sharing a seed taken out of "rand".
+	const uint64_t seed = ((uint64_t) rand() << 32) ^ (uint64_t) rand();
+
+	unsigned int created = 0, started = 0;
+	char result = 0;
+
+	for (; created < thread_count; ++created) {
+		struct batch_worker* worker = &workers[created];
+
+		worker->index = created;
+		worker->worker_count = thread_count;
+		worker->queues = queues;
+		worker->exhaustive = exhaustive;
+		worker->first_problem = first_problem;
+
+		if (NULL == create_simulator(&worker->simulator, parameters)) {
+			result = -1;
+			break;
+		}
+
+		initialize_random_generator(&worker->generator, seed, created);
+		worker->simulator.generator = &worker->generator;
+	}
+
+	// should a worker fail to start, the problems left in its
+	// queue are stolen by the others.
+	for (; 0 == result && started < thread_count; ++started)
+		if (0 != pthread_create(&workers[started].thread, NULL, batch_worker_run, &workers[started]))
+			break;
+
+	if (0 == result && 0 == started) {
+		perror("Couldn't start the threads of the workers.");
+		result = -1;
+	}
+
+	for (unsigned int i = 0; i < started; ++i)
+		pthread_join(workers[i].thread, NULL);
+
+	// the counters of the workers are only merged once all of
+	// them are done.
+	for (unsigned int i = 0; i < created; ++i) {
+		if (workers[i].failed || -1 == batch_report_merge(report, &workers[i].report))
+			result = -1;
+
+		batch_report_deallocate(&workers[i].report);
+		simulator_deallocate(&workers[i].simulator);
+	}
+
+	work_queues_deallocate(queues, thread_count);
+	free(queues);
+	free(workers);
+
+	return result;
+}
+
+// the number of problems of an exhaustive run between two
+// of its checkpoints.
+#if !defined(EXHAUSTIVE_SEGMENT)
+#define EXHAUSTIVE_SEGMENT	(1ULL << 20)
+#endif
+
+// --------------------------------------------------
+// exhaustive_problem_count
+// --------------------------------------------------
+//   returns the number of problems an exhaustive run
+//   under "parameters" has to go through, one per pair
+//   of seeds with their leading bits set (see "seed_
+//   leading_ones"), or zero if the seeds are wider than
+//   32 bits.
+// --------------------------------------------------
+unsigned long long exhaustive_problem_count(const struct system_parameters* parameters) {
+
+	const unsigned short seed_size = parameters->processor_size >> 1;
+	if (seed_size < seed_leading_ones(parameters) || seed_size > 32)
+		return 0;
+
+	const unsigned long long seed_count = 1ULL << (seed_size - seed_leading_ones(parameters));
+	return seed_count * seed_count;
+}
+
+// --------------------------------------------------
+// configuration_fingerprint
+// --------------------------------------------------
+//   returns a hash (FNV-1a) of the independent parameters
+//   of "parameters" and of their SRT table, which tells
+//   a checkpoint made for another configuration.
+// --------------------------------------------------
+uint64_t configuration_fingerprint(const struct system_parameters* parameters) {
+
+	uint64_t hash = 0xCBF29CE484222325ULL;
+
+	const unsigned short independent_parameters[] = {
+		parameters->algorithm_m, parameters->algorithm_n, parameters->algorithm_Z,
+		parameters->algorithm_alpha, parameters->algorithm_beta,
+		parameters->algorithm_ns, parameters->algorithm_np, parameters->algorithm_np_fractional,
+		parameters->algorithm_table_unsigned,
+		parameters->algorithm_residual_carrysave, parameters->algorithm_multiplier_signed,
+		parameters->algorithm_first_digit, parameters->algorithm_initialroot,
+		parameters->algorithm_loose_bit
+	};
+	for (unsigned int i = 0; i < sizeof(independent_parameters) / sizeof(independent_parameters[0]); ++i)
+		hash = (hash ^ independent_parameters[i]) * 0x100000001B3ULL;
+
+	for (unsigned int i = 0; i < parameters->SRT_table_dimensions[0]; ++i)
+		for (unsigned int j = 0; j < parameters->SRT_table_dimensions[1]; ++j)
+			hash = (hash ^ (uint16_t) srt_table_cell(parameters, i, j)) * 0x100000001B3ULL;
+
+	for (unsigned int i = 0; i < parameters->SRT_table_mappings_count; ++i)
+		for (unsigned int j = 0; j < 3; ++j)
+			hash = (hash ^ parameters->SRT_table_mappings[i][j]) * 0x100000001B3ULL;
+
+	return hash ^ parameters->SRT_table_p0;
+}
+
+// --------------------------------------------------
+// write_checkpoint
+// --------------------------------------------------
+//   writes the state of an exhaustive run under
+//   "parameters" into the file "path": the number of the
+//   next problem and the outcomes so far ("report").
+//   returns -1 on failure.
+//
+// notes:
+// - the state is written into a temporary file that then
+//   replaces "path", so that an interrupted write leaves
+//   the previous checkpoint in place.
+// --------------------------------------------------
+char write_checkpoint(const char* path, const struct system_parameters* parameters,
+					  unsigned long long next_problem, const struct batch_report* report) {
+
+	char temporary_path[strlen(path) + 5];
+	sprintf(temporary_path, "%s.tmp", path);
+
+	FILE* file = fopen(temporary_path, "w");
+	if (NULL == file) {
+		perror("Couldn't open the checkpoint file for writing.");
+		return -1;
+	}
+
+	fprintf(file, "SRT-EXHAUSTIVE-CHECKPOINT 1\n"
+			"%u %u %u %llx\n"
+			"%llu\n"
+			"%llu %llu %llu %llu\n"
+			"%u\n",
+			parameters->algorithm_m, parameters->algorithm_n, parameters->algorithm_Z,
+			(unsigned long long) configuration_fingerprint(parameters),
+			next_problem,
+			report->outcome_counts[PROBLEM_PASSED], report->outcome_counts[PROBLEM_DIVERGED],
+			report->outcome_counts[PROBLEM_OVERFLOWED], report->outcome_counts[PROBLEM_TABLE_FAILURE],
+			report->failure_count);
+
+	for (unsigned int i = 0; i < report->failure_count; ++i) {
+		const struct problem_failure* failure = &report->failures[i];
+		fprintf(file, "%d %u %u %u %s %s\n", (int) failure->outcome, failure->iteration,
+				failure->cell[0], failure->cell[1], failure->seeds[0], failure->seeds[1]);
+	}
+
+	if (0 != fclose(file) || 0 != rename(temporary_path, path)) {
+		perror("Couldn't write the checkpoint file.");
+		return -1;
+	}
+
+	return 0;
+}
+
+// --------------------------------------------------
+// read_checkpoint
+// --------------------------------------------------
+//   reads the state of an exhaustive run under
+//   "parameters" out of "file" (see "write_checkpoint")
+//   into "next_problem" and "report", and returns -1 if
+//   it is malformed or made for other parameters.
+// --------------------------------------------------
+char read_checkpoint(FILE* file, const struct system_parameters* parameters,
+					 unsigned long long* next_problem, struct batch_report* report) {
+
+	unsigned int version, m, n, Z, failure_count;
+	unsigned long long fingerprint;
+
+	if (2 != fscanf(file, "SRT-EXHAUSTIVE-CHECKPOINT %u %u", &version, &m) ||
+		1 != version ||
+		4 != fscanf(file, "%u %u %llx %llu", &n, &Z, &fingerprint, next_problem) ||
+		4 != fscanf(file, "%llu %llu %llu %llu",
+					&report->outcome_counts[PROBLEM_PASSED], &report->outcome_counts[PROBLEM_DIVERGED],
+					&report->outcome_counts[PROBLEM_OVERFLOWED], &report->outcome_counts[PROBLEM_TABLE_FAILURE]) ||
+		1 != fscanf(file, "%u", &failure_count)) {
+		perror("The checkpoint file is malformed.");
+		return -1;
+	}
+
+	if (m != parameters->algorithm_m || n != parameters->algorithm_n ||
+		Z != parameters->algorithm_Z || fingerprint != configuration_fingerprint(parameters)) {
+		perror("The checkpoint file was made for another configuration or SRT table.");
+		return -1;
+	}
+
+	if (-1 == batch_report_reserve(report, failure_count))
+		return -1;
+
+	// a seed has up to 32 digits (to the radix 2).
+	char seeds[2][33];
+
+	for (unsigned int i = 0; i < failure_count; ++i) {
+		struct problem_failure* failure = &report->failures[report->failure_count];
+		int outcome;
+
+		if (6 != fscanf(file, "%d %hu %u %u %32s %32s", &outcome, &failure->iteration,
+						&failure->cell[0], &failure->cell[1], seeds[0], seeds[1]) ||
+			outcome <= PROBLEM_PASSED || outcome >= PROBLEM_OUTCOMES) {
+			perror("The checkpoint file is malformed.");
+			return -1;
+		}
+
+		failure->outcome = (enum problem_outcome) outcome;
+		failure->seeds[0] = strdup(seeds[0]);
+		failure->seeds[1] = strdup(seeds[1]);
+		++report->failure_count;
+	}
+
+	return 0;
+}
+
+// --------------------------------------------------
+// run_exhaustive
+// --------------------------------------------------
+//   runs every problem under "parameters" on
+//   "thread_count" threads, and adds their outcomes to
+//   "report". returns -1 on failure.
+//
+//   the problems are numbered: for seeds of h bits, the
+//   problem number "i" is formed out of the seeds
+//   2^(h-1) + i / 2^(h-1) and 2^(h-1) + i % 2^(h-1).
+//   they are run in segments of EXHAUSTIVE_SEGMENT, and
+//   the state of the run is written into the file
+//   "checkpoint" after every segment. should the file
+//   exist, the run resumes from the state it holds (or
+//   merely reports it, for a finished run).
+//   the number of problems run (those not run before the
+//   run was resumed) is left in "run_count".
+// --------------------------------------------------
+char run_exhaustive(const struct system_parameters* parameters, unsigned int thread_count,
+					const char* checkpoint, struct batch_report* report, unsigned long long* run_count) {
+
+	const unsigned long long problem_count = exhaustive_problem_count(parameters);
+	unsigned long long next_problem = 0;
+
+	*run_count = 0;
+
+	FILE* file = fopen(checkpoint, "r");
+	if (NULL != file) {
+		const char result = read_checkpoint(file, parameters, &next_problem, report);
+		fclose(file);
+
+		if (-1 == result)
+			return -1;
+
+		if (next_problem >= problem_count)
+			printf("The checkpoint \"%s\" holds a finished run, whose results follow "
+				   "(remove it to run again).\n", checkpoint);
+		else
+			printf("Resuming from the checkpoint \"%s\" at problem %llu of %llu.\n",
+				   checkpoint, next_problem, problem_count);
 	}
+
+	while (next_problem < problem_count) {
+		const unsigned long long count = (problem_count - next_problem < EXHAUSTIVE_SEGMENT ?
+										  problem_count - next_problem : EXHAUSTIVE_SEGMENT);
+
+		if (-1 == run_batch(parameters, 1, next_problem, count, thread_count, report))
+			return -1;
+
+		next_problem += count;
+		*run_count += count;
+
+		if (-1 == write_checkpoint(checkpoint, parameters, next_problem, report))
+			return -1;
+	}
+
+	return 0;
+}
+
+// --------------------------------------------------
+// batch_report_print
+// --------------------------------------------------
+//   displays "report", the outcomes of a batch of
+//   "problem_count" problems run under "parameters",
+//   "run_count" of which were run within "seconds" (the
+//   others were run before the batch was resumed).
+// --------------------------------------------------
+void batch_report_print(const struct batch_report* report, const struct system_parameters* parameters,
+						unsigned long long problem_count, unsigned long long run_count, double seconds) {
+
+	for (unsigned int i = 0; i < report->failure_count; ++i)
+		batch_report_print_failure(&report->failures[i], parameters);
+
+	printf("-----------------------------------------------------------------------------\n"
+		   "Results:\n"
+		   " - problems:                 %llu\n"
+		   " - passed:                   %llu\n"
+		   " - residual diverged:        %llu\n"
+		   " - residual overflowed:      %llu\n"
+		   " - table failures:           %llu\n"
+		   " - time:                     %.3f s (%.0f problems/s)\n",
+		   problem_count, report->outcome_counts[PROBLEM_PASSED],
+		   report->outcome_counts[PROBLEM_DIVERGED], report->outcome_counts[PROBLEM_OVERFLOWED],
+		   report->outcome_counts[PROBLEM_TABLE_FAILURE],
+		   seconds, (seconds > 0 ? run_count / seconds : 0.0));
+
+	if (report->outcome_counts[PROBLEM_PASSED] == problem_count)
+		printf("ALL PROBLEMS SUCCESSFULLY VERIFIED!\n");
+}
+
+int main (int argc, const char * argv[]) {
+
+	// initializing the randomizer ensures that the random bits
+	// provided through random_bit will be different each time
+	// the program is executed.
+	if (-1 == initialize_randomizer()) return -1;
+
+	// the options, which come first and override the built-in
+	// configuration (see below) in the order they are given:
+	//   -c <file>          loads the configuration file "file"
+	//                      (see parameters_library.h)
+	//   -s <key>=<value>   sets a single parameter (as in -s np=6)
+	//   -t <file>          maps the SRT table out of the table file "file"
+	//   -w <file>          writes the SRT table into the table file "file"
+	//                      (rather than running any problem)
+	int options_end = 1;
+	while (options_end + 1 < argc && '-' == argv[options_end][0])
+		options_end += 2;
+
+	const int argument_count = argc - options_end;
+	const char** arguments = argv + options_end;
+
+	// the problems to run, as told by the other arguments:
+	//   (none)                              a single problem, which is displayed
+	//   <count> [threads]                   a batch of "count" random problems
+	//                                       (a Monte Carlo verification of the table)
+	//   exhaustive [threads [checkpoint]]   a batch of every possible problem
+	//                                       (an exhaustive verification of the table)
+	// only the outcomes of the problems of a batch are reported.
+	const unsigned char exhaustive = (argument_count > 0 && 0 == strcmp(arguments[0], "exhaustive"));
 	
-	word_pointer AB = create_word(processor_size << 1);
-	word_op_multiply(AB, B, A);
+	unsigned long long problem_count = 1;
+	if (argument_count > 0 && !exhaustive)
+		problem_count = strtoull(arguments[0], NULL, 10);
+
+	if (problem_count < 1) {
+		perror("The number of problems should be at least one.");
+		return 0;
+	}
 
-	if (0 != word_op_compare_constant(register_W, 0)) {
-		printf("\nEXTRA INFORMATION FOR TRACKING THE PROBLEM:"
-			   "\nAB(calculated) = %s\nS(mathematica) = BaseForm[Sqrt[%s * %s],%d]\n", 
-			   buffer1 = word_makestring(AB, 1 << algorithm_m),
-			   buffer2 = word_makemathematicacode(A),
-			   buffer3 = word_makemathematicacode(B), 1 << algorithm_m);
+	// the number of threads a batch of problems is spread
+	// over, one per core unless given as the second argument.
+	long thread_count = sysconf(_SC_NPROCESSORS_ONLN);
+	if (argument_count > 1)
+		thread_count = atol(arguments[1]);
+
+	if (thread_count < 1)
+		thread_count = 1;
+
+	// the checkpoint file of an exhaustive batch, named after
+	// the configuration unless given (see below)
+	const char* checkpoint = (argument_count > 2 ? arguments[2] : NULL);
+	char checkpoint_name[64];
+
+	// the built-in configuration, which the options override
+	struct system_parameters parameters;
+	if (-1 == system_parameters_builtin(&parameters))
+		return 0;
+
+	// the table file to write, if any
+	const char* table_output = NULL;
+
+	for (int option = 1; option < options_end; option += 2) {
+		char result = -1;
+
+		if (0 == strcmp(argv[option], "-w")) {
+			table_output = argv[option + 1];
+			result = 0;
+		} else if (1 == (result = system_parameters_option(&parameters, argv[option], argv[option + 1]))) {
+			fprintf(stderr, "Unknown option \"%s\" (use -c, -s, -t or -w).\n", argv[option]);
+			result = -1;
+		}
+
+		if (-1 == result) {
+			system_parameters_deallocate(&parameters);
+			return 0;
+		}
+	}
+
+	// the dependent system parameters (the number of iterations
+	// and the widths of the registers) follow the others.
+	if (-1 == system_parameters_derive(&parameters)) {
+		system_parameters_deallocate(&parameters);
+		return 0;
+	}
+
+	if (NULL != table_output) {
+		if (0 == system_parameters_write_table(&parameters, table_output))
+			printf("The SRT table (%u × %u) was written into \"%s\".\n",
+				   parameters.SRT_table_dimensions[0], parameters.SRT_table_dimensions[1], table_output);
+
+		system_parameters_deallocate(&parameters);
+		return 0;
+	}
+
+	if (exhaustive) {
+		problem_count = exhaustive_problem_count(&parameters);
 		
-		free(buffer1);
-		free(buffer2);
-		free(buffer3);	
+		if (0 == problem_count) {
+			perror("An exhaustive batch needs seeds (operands) of up to 32 (64) bits.");
+			system_parameters_deallocate(&parameters);
+			return 0;
+		}
+
+		// each configuration has a checkpoint of its own by
+		// default, so that the runs of several configurations
+		// can be resumed side by side.
+		if (NULL == checkpoint) {
+			snprintf(checkpoint_name, sizeof(checkpoint_name), "exhaustive.%016llx.checkpoint",
+					 (unsigned long long) configuration_fingerprint(&parameters));
+			checkpoint = checkpoint_name;
+		}
 	}
+
+	if ((unsigned long long) thread_count > problem_count)
+		thread_count = (long) problem_count;
+
+	printf(
+		"-----------------------------------------------------------------------------\n"		   
+		"           ORWA-AMIN MULTIPLICATIVE SQUARE-ROOT ALGORITHM SIMULATOR          \n"
+		"-----------------------------------------------------------------------------\n"
+		" Configuration: <ADVANCED> \n"
+		" - Signed-digit result with on-the-fly conversion of digits: YES\n"
+		" - Supports rounding: YES\n"
+		" - Actual digit selection: YES\n"
+		" - Digit selection using an actual table: YES\n"
+		" - Carry-Save residual: %s\n"
+		" - Signed-digit multiplier B with automatic conversion: %s\n"
+		"-----------------------------------------------------------------------------\n",
+		   parameters.algorithm_residual_carrysave ? "YES" : "NO",
+		   parameters.algorithm_multiplier_signed ? "YES" : "NO");
 	
-	// deallocate memory
+	printf("System parameters:\n"
+		   " - m: %d bits\t\t→ RADIX = %d\n - n: %d iterations\n - Z: %d bits\n"
+		   "\nSystem variables:\n"
+		   " - size of operands:    %d bits\n"			// "m × n ="
+		   " - iterations:			%d iteration(s)\n",	// "n + ⎡Z+2/m⎤ = "
+		   parameters.algorithm_m, 1 << parameters.algorithm_m,
+		   parameters.algorithm_n, parameters.algorithm_Z,
+		   parameters.processor_size, parameters.iterations);
+
+	if (1 == problem_count && !exhaustive) {
+		printf(
 #if !defined(SUPPRESS_DETAILS)
-	free(delimiter);
+			   "-----------------------------------------------------------------------------\n"
+			   " TYPE OF SIMULATION: One-problem demonstration S = √A × B\n"
+			   "-----------------------------------------------------------------------------\n"
+#else
+			   "-----------------------------------------------------------------------------\n"
+			   " TYPE OF SIMULATION: One-problem verification\n"
+			   "-----------------------------------------------------------------------------\n"
 #endif
-	word_deallocate(digit_multiplier_S);	
-	word_deallocate(digit_multiplier_S_practical);	
-	word_deallocate(digit_multiplier_B);	
-	word_deallocate(register_W);
-	word_deallocate(register_W_practical);	
-	word_deallocate(register_A);
-	word_deallocate(onthefly_appended_digit);			
-	word_deallocate(onthefly_appended_digit_m1);
-	word_deallocate(onthefly_appended_digit_t2);			
-	word_deallocate(onthefly_appended_digit_t2m1);
-	word_deallocate(register_2S);		
-	word_deallocate(register_2S_m1);			
-	word_deallocate(register_S);	
-	word_deallocate(register_S_practical);	
-	word_deallocate(register_S_m1);	
-	word_deallocate(P_mask);
-	word_deallocate(P);
-	word_deallocate(Sdot);
-	free(B_digits);
-	free(S_prime_digits);
-	word_deallocate(S_prime);
-	
-	word_deallocate(S);
-	word_deallocate(random_seed2);	
-	word_deallocate(random_seed1);	
-	word_deallocate(B);		
-	word_deallocate(A);	
+			   );
+	} else {
+		printf("-----------------------------------------------------------------------------\n"
+			   " TYPE OF SIMULATION: %s verification (%llu problems, %ld threads)\n"
+			   "-----------------------------------------------------------------------------\n",
+			   (exhaustive ? "Exhaustive" : "Monte Carlo"), problem_count, thread_count);
+	}
+
+	if (1 == problem_count && !exhaustive) {
+		struct simulator simulator;
+		if (NULL != create_simulator(&simulator, &parameters)) {
+			simulator_randomize(&simulator);
+			simulate_problem(&simulator, 1);
+			simulator_deallocate(&simulator);
+		}
+
+		system_parameters_deallocate(&parameters);
+		return 0;
+	}
+
+	// -------------------------------------
+	// a batch of problems
+	// -------------------------------------
+	struct batch_report report;
+	memset((void*) &report, 0, sizeof(report));
+
+	struct timeval start;
+	gettimeofday(&start, NULL);
+
+	// (the problems run before an exhaustive batch was resumed
+	// are not timed)
+	unsigned long long run_count = problem_count;
 	
+	const char result = (exhaustive ?
+		run_exhaustive(&parameters, (unsigned int) thread_count, checkpoint, &report, &run_count) :
+		run_batch(&parameters, 0, 0, problem_count, (unsigned int) thread_count, &report));
+
+	if (-1 == result) {
+		batch_report_deallocate(&report);
+		system_parameters_deallocate(&parameters);
+		return 0;
+	}
+
+	const double seconds = elapsed_microseconds(&start) / 1e6;
+
+	batch_report_print(&report, &parameters, problem_count, run_count, seconds);
+
+	// deallocate memory
+	batch_report_deallocate(&report);
+	system_parameters_deallocate(&parameters);
+
 	return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,950 @@
+/*
+ *  parameters_library.h
+ *  mechanical project
+ *
+ *  the system parameters of the algorithm, which are set at
+ *  run time out of configuration files and the command line.
+ *
+ */
+
+#include <stddef.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+//
+// --- d o c u m e n t a t i o n --- s t a r t s --- h e r e
+//
+// BASIC CODE CONCEPTS:
+//
+// "independent parameters":
+//		are the parameters that define a configuration of the algorithm: the radix (m), the number
+//		of digits of the operands (n), the delay (Z), the digit set (alpha, beta), the widths of
+//		the samples of the result and the residual (ns, np and np_fractional), the SRT table and
+//		the way it is indexed (first_digit, initialroot and loose_bit), and the options of the
+//		hardware (table_unsigned, residual_carrysave and multiplier_signed).
+//
+// "dependent parameters":
+//		are computed out of the independent ones by "system_parameters_derive" (the number of
+//		iterations, delta, mb, the size of the operands and the widths of the registers), which has
+//		to be called once all the independent parameters are set.
+//
+//
+// TECHNICAL DETAILS:
+//
+//  - configuration files:
+//		are text files of "key = value" lines, where "#" starts a comment. the keys are the names
+//		of the independent parameters above and "p0", the row of the SRT table which P = 0 falls
+//		into (see "system_parameter_keys"), along with:
+//
+//			table = <rows> <columns>	followed by the rows x columns cells of the SRT table, row
+//										by row (braces and commas are ignored, so that the rows of
+//										a table can be pasted out of C source).
+//			mapping = <from> <to> <i>	maps the column "from" of the table to the column "to" at
+//										the iteration "i" (the columns are counted from one). a
+//										"table" line drops the mappings given before it.
+//			table_file = <path>			maps the SRT table out of a table file (see below), along
+//										with its p0, symmetric flag (table_unsigned) and mappings.
+//
+//		a later line overrides an earlier one, and so does a later file or a "key=value" argument
+//		(see "system_parameters_set") the parameters set before, hence a file only needs to hold
+//		what differs from the built-in configuration.
+//
+//  - table files:
+//		hold an SRT table in a compact binary format, which is mapped into memory rather than read,
+//		so that a large table is loaded at once and its pages are shared (read only) by all the
+//		processes that map the same file. all the fields are little-endian:
+//
+//			offset	size
+//			0		8		"SRTTABLE"
+//			8		2		version (SRT_TABLE_FILE_VERSION)
+//			10		2		rows
+//			12		2		columns
+//			14		2		p0
+//			16		1		flags (bit 0: the table is symmetric, as in table_unsigned)
+//			17		1		the width of a cell, in bits (up to 16)
+//			18		2		the smallest cell (signed)
+//			20		2		the number of mappings
+//			22		2		reserved (zero)
+//			24		6 × k	the k mappings, as three 16-bit fields (from, to, iteration)
+//			24 + 6k			the cells, row by row, each one packed into "width" bits (from the least-
+//							significant bit of the first byte on) as its difference to the smallest
+//							cell, followed by at least two bytes of padding.
+//
+//		the padding lets a cell be read out of three whole bytes wherever it falls (see
+//		"srt_table_cell"). a table file is written out of a configuration by
+//		"system_parameters_write_table".
+//
+//  - ownership:
+//		the SRT table and its mappings are copied into storage owned by the parameters (or mapped,
+//		for the cells of a table file), which is released by "system_parameters_deallocate".
+//
+// --- d o c u m e n t a t i o n --- e n d s --- h e r e
+//
+
+// --------------------------------------------------
+// system_parameters
+// --------------------------------------------------
+//   the system parameters of the algorithm, which are
+//   shared by all the problems of a simulation.
+// --------------------------------------------------
+struct system_parameters {
+	// independent system parameters
+	//   - SET 1: BASIC-THEORETICAL
+	unsigned short algorithm_m, algorithm_n, algorithm_Z;
+	//   - SET 2: BASIC-PRACTICAL
+	unsigned short algorithm_alpha, algorithm_beta,
+		algorithm_ns, algorithm_np, algorithm_np_fractional,
+		algorithm_table_unsigned;
+	unsigned char algorithm_residual_carrysave, algorithm_multiplier_signed;
+	//   - SET 3: DIGIT SELECTION (see "simulate_problem")
+	unsigned char algorithm_first_digit, algorithm_initialroot, algorithm_loose_bit;
+
+	// the SRT table (row by row, SRT_table_dimensions[1]
+	// cells per row) and the way it is indexed
+	// (the cells should be read through "srt_table_cell")
+	short* SRT_table;
+	unsigned short SRT_table_dimensions[2];
+	unsigned short SRT_table_p0;
+	unsigned short (*SRT_table_mappings)[3];
+	unsigned short SRT_table_mappings_count;
+
+	// dependent system parameters
+	unsigned short iterations, delta, mb, processor_size;
+	unsigned short register_S_size, register_A_size, register_W_size;
+
+	// the packed cells of the SRT table, when it is mapped
+	// out of a table file (SRT_table is NULL then), along
+	// with the mapping of the whole file.
+	const unsigned char* SRT_table_packed;
+	unsigned char SRT_table_cell_bits;
+	short SRT_table_cell_minimum;
+	void* SRT_table_file;
+	size_t SRT_table_file_size;
+};
+
+// the ways the first digit of the result (at the iteration
+// delta) is selected (see "algorithm_first_digit")
+#define FIRST_DIGIT_SELECTOR	0
+#define FIRST_DIGIT_HARDWIRED	1
+#define FIRST_DIGIT_TABLE		2
+
+// the version of the table files written and understood
+// (see "table files" above)
+#define SRT_TABLE_FILE_VERSION	1
+#define SRT_TABLE_FILE_HEADER	24
+
+// --------------------------------------------------
+// srt_table_cell
+// --------------------------------------------------
+//   returns the cell at "row" and "column" of the SRT
+//   table of "parameters", which should be within the
+//   dimensions of the table.
+// --------------------------------------------------
+static inline short srt_table_cell(const struct system_parameters* parameters,
+								   unsigned int row, unsigned int column) {
+
+	const unsigned long index = (unsigned long) row * parameters->SRT_table_dimensions[1] + column;
+
+	if (NULL == parameters->SRT_table_packed)
+		return parameters->SRT_table[index];
+
+	// a cell of up to 16 bits spans at most three bytes,
+	// which the padding of the table file makes readable
+	// even for the last cell.
+	const unsigned long bit = index * parameters->SRT_table_cell_bits;
+	const unsigned char* bytes = parameters->SRT_table_packed + (bit >> 3);
+	const uint32_t window = bytes[0] | ((uint32_t) bytes[1] << 8) | ((uint32_t) bytes[2] << 16);
+
+	return (short) (parameters->SRT_table_cell_minimum +
+		(int) ((window >> (bit & 7)) & ((1U << parameters->SRT_table_cell_bits) - 1)));
+}
+
+// the independent parameters that are set by name (see
+// "system_parameters_set"), along with the largest value
+// they may take.
+static const struct system_parameter_key {
+	const char* name;
+	size_t offset;
+	// set for the unsigned char parameters (the others
+	// are unsigned short)
+	unsigned char is_flag;
+	unsigned long maximum;
+} system_parameter_keys[] = {
+	{"m",					offsetof(struct system_parameters, algorithm_m),					0, 16},
+	{"n",					offsetof(struct system_parameters, algorithm_n),					0, 0xFFFF},
+	{"Z",					offsetof(struct system_parameters, algorithm_Z),					0, 0xFFFF},
+	{"alpha",				offsetof(struct system_parameters, algorithm_alpha),				0, 0xFFFF},
+	{"beta",				offsetof(struct system_parameters, algorithm_beta),					0, 0xFFFF},
+	{"ns",					offsetof(struct system_parameters, algorithm_ns),					0, 31},
+	{"np",					offsetof(struct system_parameters, algorithm_np),					0, 30},
+	{"np_fractional",		offsetof(struct system_parameters, algorithm_np_fractional),		0, 30},
+	{"table_unsigned",		offsetof(struct system_parameters, algorithm_table_unsigned),		0, 1},
+	{"residual_carrysave",	offsetof(struct system_parameters, algorithm_residual_carrysave),	1, 1},
+	{"multiplier_signed",	offsetof(struct system_parameters, algorithm_multiplier_signed),	1, 1},
+	{"first_digit",			offsetof(struct system_parameters, algorithm_first_digit),			1, 2},
+	{"initialroot",			offsetof(struct system_parameters, algorithm_initialroot),			1, 1},
+	{"loose_bit",			offsetof(struct system_parameters, algorithm_loose_bit),			1, 1},
+	{"p0",					offsetof(struct system_parameters, SRT_table_p0),					0, 0xFFFF}
+};
+
+// --------------------------------------------------
+// system_parameters_drop_table
+// --------------------------------------------------
+//   releases the SRT table of "parameters" and its
+//   mappings, whether they are owned or mapped.
+// --------------------------------------------------
+void system_parameters_drop_table(struct system_parameters* parameters) {
+
+	free(parameters->SRT_table);
+	free(parameters->SRT_table_mappings);
+
+	if (NULL != parameters->SRT_table_file)
+		munmap(parameters->SRT_table_file, parameters->SRT_table_file_size);
+
+	parameters->SRT_table = NULL;
+	parameters->SRT_table_mappings = NULL;
+	parameters->SRT_table_mappings_count = 0;
+	parameters->SRT_table_packed = NULL;
+	parameters->SRT_table_file = NULL;
+	parameters->SRT_table_file_size = 0;
+}
+
+// --------------------------------------------------
+// system_parameters_set_table
+// --------------------------------------------------
+//   copies the "rows" x "columns" cells pointed by
+//   "cells" (row by row) into the SRT table of
+//   "parameters", and drops its mappings. returns -1
+//   on failure.
+// --------------------------------------------------
+char system_parameters_set_table(struct system_parameters* parameters, const short* cells,
+								 unsigned short rows, unsigned short columns) {
+
+	if (0 == rows || 0 == columns) {
+		perror("The SRT table should have at least one row and one column.");
+		return -1;
+	}
+
+	short* table = malloc(sizeof(short) * rows * columns);
+
+	assert(NULL != table);
+	if (NULL == table) {
+		perror("Couldn't allocate memory for the SRT table.");
+		return -1;
+	}
+
+	if (NULL != cells)
+		memcpy(table, cells, sizeof(short) * rows * columns);
+
+	system_parameters_drop_table(parameters);
+
+	parameters->SRT_table = table;
+	parameters->SRT_table_dimensions[0] = rows;
+	parameters->SRT_table_dimensions[1] = columns;
+
+	return 0;
+}
+
+// --------------------------------------------------
+// system_parameters_add_mapping
+// --------------------------------------------------
+//   maps the column "from" of the SRT table of
+//   "parameters" to the column "to" at the iteration
+//   "iteration". returns -1 on failure.
+// --------------------------------------------------
+char system_parameters_add_mapping(struct system_parameters* parameters, unsigned short from,
+								   unsigned short to, unsigned short iteration) {
+
+	unsigned short (*mappings)[3] = realloc(parameters->SRT_table_mappings,
+		sizeof(unsigned short[3]) * (parameters->SRT_table_mappings_count + 1));
+
+	assert(NULL != mappings);
+	if (NULL == mappings) {
+		perror("Couldn't allocate memory for the mappings of the SRT table.");
+		return -1;
+	}
+
+	mappings[parameters->SRT_table_mappings_count][0] = from;
+	mappings[parameters->SRT_table_mappings_count][1] = to;
+	mappings[parameters->SRT_table_mappings_count][2] = iteration;
+
+	parameters->SRT_table_mappings = mappings;
+	++parameters->SRT_table_mappings_count;
+
+	return 0;
+}
+
+// --------------------------------------------------
+// read_le16
+// --------------------------------------------------
+//   returns the little-endian 16-bit field at "bytes".
+// --------------------------------------------------
+static inline uint16_t read_le16(const unsigned char* bytes) {
+	return (uint16_t) (bytes[0] | (bytes[1] << 8));
+}
+
+// --------------------------------------------------
+// system_parameters_map_table
+// --------------------------------------------------
+//   maps the SRT table of "parameters" out of the table
+//   file "path" (see "table files" above), which sets
+//   its p0, symmetric flag and mappings as well. returns
+//   -1 on failure.
+// --------------------------------------------------
+char system_parameters_map_table(struct system_parameters* parameters, const char* path) {
+
+	const int descriptor = open(path, O_RDONLY);
+	if (-1 == descriptor) {
+		perror(path);
+		return -1;
+	}
+
+	struct stat status;
+	if (-1 == fstat(descriptor, &status) || status.st_size < SRT_TABLE_FILE_HEADER) {
+		fprintf(stderr, "%s: not a table file (too short).\n", path);
+		close(descriptor);
+		return -1;
+	}
+
+	const size_t size = (size_t) status.st_size;
+	// (the mapping is shared, so that the processes that map
+	// the same table share its pages)
+	void* file = mmap(NULL, size, PROT_READ, MAP_SHARED, descriptor, 0);
+	close(descriptor);
+
+	if (MAP_FAILED == file) {
+		perror(path);
+		return -1;
+	}
+
+	const unsigned char* header = (const unsigned char*) file;
+
+	const unsigned short rows = read_le16(header + 10), columns = read_le16(header + 12);
+	const unsigned short mappings_count = read_le16(header + 20);
+	const unsigned char cell_bits = header[17];
+
+	const size_t cells_offset = SRT_TABLE_FILE_HEADER + (size_t) 6 * mappings_count;
+	const size_t cells_size = ((size_t) rows * columns * cell_bits + 7) / 8 + 2;
+
+	if (0 != memcmp(header, "SRTTABLE", 8) || SRT_TABLE_FILE_VERSION != read_le16(header + 8)) {
+		fprintf(stderr, "%s: not a table file (or of another version).\n", path);
+		munmap(file, size);
+		return -1;
+	}
+
+	if (0 == rows || 0 == columns || cell_bits > 16 || cells_offset + cells_size > size) {
+		fprintf(stderr, "%s: the table file is damaged (its fields don't match its size).\n", path);
+		munmap(file, size);
+		return -1;
+	}
+
+	system_parameters_drop_table(parameters);
+
+	parameters->SRT_table_dimensions[0] = rows;
+	parameters->SRT_table_dimensions[1] = columns;
+	parameters->SRT_table_p0 = read_le16(header + 14);
+	parameters->algorithm_table_unsigned = header[16] & 1;
+	parameters->SRT_table_cell_bits = cell_bits;
+	parameters->SRT_table_cell_minimum = (short) read_le16(header + 18);
+	parameters->SRT_table_packed = header + cells_offset;
+	parameters->SRT_table_file = file;
+	parameters->SRT_table_file_size = size;
+
+	for (unsigned int i = 0; i < mappings_count; ++i) {
+		const unsigned char* mapping = header + SRT_TABLE_FILE_HEADER + 6 * i;
+
+		if (-1 == system_parameters_add_mapping(parameters,
+				read_le16(mapping), read_le16(mapping + 2), read_le16(mapping + 4)))
+			return -1;
+	}
+
+	return 0;
+}
+
+// --------------------------------------------------
+// system_parameters_write_table
+// --------------------------------------------------
+//   writes the SRT table of "parameters", along with
+//   its p0, symmetric flag and mappings, into the table
+//   file "path" (see "table files" above), packing its
+//   cells into as few bits as they need. returns -1 on
+//   failure.
+// --------------------------------------------------
+char system_parameters_write_table(const struct system_parameters* parameters, const char* path) {
+
+	const unsigned short rows = parameters->SRT_table_dimensions[0];
+	const unsigned short columns = parameters->SRT_table_dimensions[1];
+	const unsigned long cell_count = (unsigned long) rows * columns;
+
+	// the range of the cells sets the width they are packed
+	// into.
+	short minimum = srt_table_cell(parameters, 0, 0), maximum = minimum;
+	for (unsigned long i = 0; i < cell_count; ++i) {
+		const short cell = srt_table_cell(parameters, i / columns, i % columns);
+
+		if (cell < minimum) minimum = cell;
+		if (cell > maximum) maximum = cell;
+	}
+
+	unsigned char cell_bits = 0;
+	while ((1L << cell_bits) <= (long) maximum - minimum)
+		++cell_bits;
+
+	const unsigned short mappings_count = parameters->SRT_table_mappings_count;
+	const size_t cells_offset = SRT_TABLE_FILE_HEADER + (size_t) 6 * mappings_count;
+	const size_t size = cells_offset + (cell_count * cell_bits + 7) / 8 + 2;
+
+	unsigned char* contents = calloc(size, 1);
+
+	assert(NULL != contents);
+	if (NULL == contents) {
+		perror("Couldn't allocate memory for the table file.");
+		return -1;
+	}
+
+	const uint16_t fields[] = {
+		SRT_TABLE_FILE_VERSION, rows, columns, parameters->SRT_table_p0
+	};
+	memcpy(contents, "SRTTABLE", 8);
+	for (unsigned int i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i) {
+		contents[8 + 2 * i] = (unsigned char) fields[i];
+		contents[8 + 2 * i + 1] = (unsigned char) (fields[i] >> 8);
+	}
+
+	contents[16] = (parameters->algorithm_table_unsigned ? 1 : 0);
+	contents[17] = cell_bits;
+	contents[18] = (unsigned char) (uint16_t) minimum;
+	contents[19] = (unsigned char) ((uint16_t) minimum >> 8);
+	contents[20] = (unsigned char) mappings_count;
+	contents[21] = (unsigned char) (mappings_count >> 8);
+
+	for (unsigned int i = 0; i < mappings_count; ++i) {
+		for (unsigned int j = 0; j < 3; ++j) {
+			contents[SRT_TABLE_FILE_HEADER + 6 * i + 2 * j] =
+				(unsigned char) parameters->SRT_table_mappings[i][j];
+			contents[SRT_TABLE_FILE_HEADER + 6 * i + 2 * j + 1] =
+				(unsigned char) (parameters->SRT_table_mappings[i][j] >> 8);
+		}
+	}
+
+	for (unsigned long i = 0; i < cell_count; ++i) {
+		const unsigned long value = (unsigned long)
+			(srt_table_cell(parameters, i / columns, i % columns) - minimum);
+
+		for (unsigned int k = 0; k < cell_bits; ++k)
+			if ((value >> k) & 1) {
+				const unsigned long bit = i * cell_bits + k;
+				contents[cells_offset + (bit >> 3)] |= (unsigned char) (1 << (bit & 7));
+			}
+	}
+
+	FILE* file = fopen(path, "wb");
+	char result = 0;
+
+	if (NULL == file || size != fwrite(contents, 1, size, file)) {
+		perror(path);
+		result = -1;
+	}
+
+	if (NULL != file && 0 != fclose(file) && 0 == result) {
+		perror(path);
+		result = -1;
+	}
+
+	free(contents);
+
+	return result;
+}
+
+// --------------------------------------------------
+// system_parameters_set
+// --------------------------------------------------
+//   sets the independent parameter named "key" (see
+//   "system_parameter_keys") of "parameters" to "value",
+//   given in decimal. returns -1 on failure.
+// --------------------------------------------------
+char system_parameters_set(struct system_parameters* parameters, const char* key, const char* value) {
+
+	for (unsigned int i = 0; i < sizeof(system_parameter_keys) / sizeof(system_parameter_keys[0]); ++i) {
+		const struct system_parameter_key* parameter = &system_parameter_keys[i];
+
+		if (0 != strcmp(key, parameter->name))
+			continue;
+
+		char* end = NULL;
+		const unsigned long number = strtoul(value, &end, 10);
+
+		if (end == value || '\0' != *end || '-' == *value || number > parameter->maximum) {
+			fprintf(stderr, "The value \"%s\" of the parameter \"%s\" should be a number "
+					"from 0 to %lu.\n", value, key, parameter->maximum);
+			return -1;
+		}
+
+		if (parameter->is_flag)
+			*((unsigned char*) parameters + parameter->offset) = (unsigned char) number;
+		else
+			*(unsigned short*) ((unsigned char*) parameters + parameter->offset) = (unsigned short) number;
+
+		return 0;
+	}
+
+	fprintf(stderr, "Unknown parameter \"%s\".\n", key);
+	return -1;
+}
+
+// --------------------------------------------------
+// system_parameters_assign
+// --------------------------------------------------
+//   sets a parameter of "parameters" out of "argument",
+//   which reads "key=value". returns -1 on failure.
+// --------------------------------------------------
+char system_parameters_assign(struct system_parameters* parameters, const char* argument) {
+
+	const char* equals = strchr(argument, '=');
+
+	if (NULL == equals || equals == argument || equals - argument >= 32) {
+		fprintf(stderr, "The parameter \"%s\" should read \"key=value\".\n", argument);
+		return -1;
+	}
+
+	char key[32];
+	memcpy(key, argument, equals - argument);
+	key[equals - argument] = '\0';
+
+	return system_parameters_set(parameters, key, equals + 1);
+}
+
+// --------------------------------------------------
+// read_numbers
+// --------------------------------------------------
+//   reads "count" numbers out of "file" into "numbers",
+//   skipping white space, braces, commas and comments,
+//   along with the rest of the line of the last number.
+//   returns the number of numbers read, and counts the
+//   lines read into "line_number".
+// --------------------------------------------------
+unsigned long read_numbers(FILE* file, long* numbers, unsigned long count, unsigned int* line_number) {
+
+	unsigned long read = 0;
+	int character;
+
+	while (EOF != (character = fgetc(file))) {
+		// (a comment runs up to the end of its line, and so
+		// does the line of the last number)
+		if ('#' == character || read == count)
+			while ('\n' != character && EOF != (character = fgetc(file)));
+
+		if ('\n' == character) {
+			++*line_number;
+			if (read == count)
+				break;
+		} else if (EOF != character && !isspace(character) &&
+				   '{' != character && '}' != character && ',' != character) {
+			ungetc(character, file);
+			if (1 != fscanf(file, "%ld", &numbers[read]))
+				break;
+			++read;
+		}
+	}
+
+	return read;
+}
+
+// --------------------------------------------------
+// system_parameters_load
+// --------------------------------------------------
+//   sets the parameters of "parameters" held by the
+//   configuration file "file" (named "name", for the
+//   error messages). returns -1 on failure.
+// --------------------------------------------------
+char system_parameters_load(struct system_parameters* parameters, FILE* file, const char* name) {
+
+	char line[512];
+	unsigned int line_number = 0;
+
+	while (NULL != fgets(line, sizeof(line), file)) {
+		++line_number;
+
+		char* comment = strchr(line, '#');
+		if (NULL != comment)
+			*comment = '\0';
+
+		char key[32], value[256];
+		const int fields = sscanf(line, " %31[^= \t\n] = %255[^\n]", key, value);
+
+		if (fields <= 0)
+			continue;
+
+		if (1 == fields) {
+			fprintf(stderr, "%s:%u: a line should read \"key = value\".\n", name, line_number);
+			return -1;
+		}
+
+		// (trailing white space is not part of the value)
+		size_t length = strlen(value);
+		while (length > 0 && isspace((unsigned char) value[length - 1]))
+			value[--length] = '\0';
+
+		if (0 == strcmp(key, "table")) {
+			unsigned int rows = 0, columns = 0;
+
+			if (2 != sscanf(value, "%u %u", &rows, &columns) ||
+				rows > 0xFFFF || columns > 0xFFFF ||
+				-1 == system_parameters_set_table(parameters, NULL, rows, columns)) {
+				fprintf(stderr, "%s:%u: the table should read \"table = <rows> <columns>\".\n",
+						name, line_number);
+				return -1;
+			}
+
+			const unsigned long cell_count = (unsigned long) rows * columns;
+			long* cells = malloc(sizeof(long) * cell_count);
+
+			assert(NULL != cells);
+			if (NULL == cells) {
+				perror("Couldn't allocate memory for the cells of the SRT table.");
+				return -1;
+			}
+
+			const unsigned long read = read_numbers(file, cells, cell_count, &line_number);
+
+			for (unsigned long i = 0; i < read; ++i)
+				parameters->SRT_table[i] = (short) cells[i];
+
+			free(cells);
+
+			if (read != cell_count) {
+				fprintf(stderr, "%s:%u: the table holds %lu of its %lu cells.\n",
+						name, line_number, read, cell_count);
+				return -1;
+			}
+		} else if (0 == strcmp(key, "table_file")) {
+			if (-1 == system_parameters_map_table(parameters, value)) {
+				fprintf(stderr, "%s:%u: the table file couldn't be mapped.\n", name, line_number);
+				return -1;
+			}
+		} else if (0 == strcmp(key, "mapping")) {
+			unsigned int from = 0, to = 0, iteration = 0;
+
+			if (3 != sscanf(value, "%u %u %u", &from, &to, &iteration) ||
+				from > 0xFFFF || to > 0xFFFF || iteration > 0xFFFF) {
+				fprintf(stderr, "%s:%u: a mapping should read \"mapping = <from> <to> <iteration>\".\n",
+						name, line_number);
+				return -1;
+			}
+
+			if (-1 == system_parameters_add_mapping(parameters, from, to, iteration))
+				return -1;
+		} else if (-1 == system_parameters_set(parameters, key, value)) {
+			fprintf(stderr, "%s:%u: invalid parameter.\n", name, line_number);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+// --------------------------------------------------
+// system_parameters_builtin
+// --------------------------------------------------
+//   sets "parameters" to the built-in configuration,
+//   which the options override (see "system_parameters_
+//   option"). returns -1 on failure.
+//
+// notes:
+// - the dependent parameters are left to "system_
+//   parameters_derive", as for any other configuration.
+// --------------------------------------------------
+char system_parameters_builtin(struct system_parameters* parameters) {
+
+	// independent system parameters
+	//   - SET 1: BASIC-THEORETICAL
+	const unsigned short 
+		algorithm_m = 2,
+		algorithm_n = 10,
+		algorithm_Z = 4;
+
+	//   - SET 2: BASIC-PRACTICAL
+	const unsigned short
+		algorithm_alpha = 3,
+		algorithm_beta = 3,
+		algorithm_ns = 3,
+		algorithm_np = 5,
+		algorithm_np_fractional = 2,
+		algorithm_table_unsigned = 1;
+
+	// whether the practical residual is kept in a carry-save
+	// format, in which case the table is indexed by an estimate
+	// of P that may be one unit too low. the table below takes
+	// such an estimate as long as a negative one is mirrored
+	// through its ones' complement (see "main.c"), which is
+	// what a symmetric table does with a carry-save residual.
+	const unsigned char algorithm_residual_carrysave = 1;
+
+	// whether the digits of the multiplier B are recoded into
+	// signed digits before they are fed to the algorithm (see
+	// "word_makesignedlist"). the digits consumed by the
+	// iterations then lie within {-2^(m-1), ..., +2^(m-1)},
+	// which halves the largest multiple of A that the partial
+	// product can take, while the leading digit b1, which only
+	// initializes the residual (W = b1×A), lies within {0, ...,
+	// 2^m} as B is unsigned.
+	const unsigned char algorithm_multiplier_signed = 1;
+
+	//   - SET 3: DIGIT SELECTION
+	// how the first digit is selected: by the First-Digit
+	// Selector out of the top bits of the residual (FIRST_
+	// DIGIT_SELECTOR), hardwired to one (FIRST_DIGIT_HARD-
+	// WIRED) or looked up in the table like the others
+	// (FIRST_DIGIT_TABLE).
+	const unsigned char algorithm_first_digit = FIRST_DIGIT_SELECTOR;
+	// whether the table was derived for an initial root of
+	// one; if cleared, the S region indices are translated by
+	// one column (the first column of the table is left out).
+	const unsigned char algorithm_initialroot = 1;
+	// whether 2S and 2P, rather than S and P, are passed to
+	// the table when the leading fractional bit of the result
+	// is clear (the loose-bit signal); if cleared, the table
+	// is indexed at the same positions in every iteration.
+	const unsigned char algorithm_loose_bit = 1;
+
+	const short SRT_table[][4] = {
+		{4, 4, 4, 3},
+		{4, 4, 4, 3},
+		{4, 4, 4, 3},
+		{4, 4, 4, 3},
+		{4, 4, 3, 3},
+		{4, 4, 3, 3},
+		{4, 4, 3, 3},
+		{4, 4, 3, 3},
+		{4, 3, 3, 3},
+		{4, 3, 3, 3},
+		{4, 3, 3, 3},
+		{4, 3, 3, 3},
+		{3, 3, 3, 3},
+		{3, 3, 3, 2},
+		{3, 3, 3, 2},
+		{3, 3, 3, 2},
+		{3, 3, 3, 2},
+		{3, 3, 2, 2},
+		{3, 3, 2, 2},
+		{3, 2, 2, 2},
+		{3, 2, 2, 2},
+		{3, 2, 2, 1},
+		{2, 2, 2, 1},
+		{2, 2, 2, 1},
+		{2, 2, 2, 1},
+		{2, 1, 1, 1},
+		{2, 1, 1, 1},
+		{1, 1, 1, 1},
+		{1, 1, 1, 1},
+		{1, 0, 0, 0},
+		{1, 0, 0, 0},
+		{0, 0, 0, 0},
+		{0, 0, 0, 0}
+	};
+
+	const unsigned short SRT_table_dimensions[] = {33,4};
+	const unsigned short SRT_table_p0 = 8 << algorithm_np_fractional;
+
+	const struct system_parameters builtin = {
+		algorithm_m, algorithm_n, algorithm_Z,
+		algorithm_alpha, algorithm_beta,
+		algorithm_ns, algorithm_np, algorithm_np_fractional,
+		algorithm_table_unsigned,
+		algorithm_residual_carrysave, algorithm_multiplier_signed,
+		algorithm_first_digit, algorithm_initialroot, algorithm_loose_bit,
+
+		NULL, {0, 0}, SRT_table_p0, NULL, 0,
+
+		// (the dependent parameters are left to
+		// "system_parameters_derive")
+		0, 0, 0, 0, 0, 0, 0,
+
+		NULL, 0, 0, NULL, 0
+	};
+
+	*parameters = builtin;
+
+	return system_parameters_set_table(parameters, &SRT_table[0][0],
+									   SRT_table_dimensions[0], SRT_table_dimensions[1]);
+}
+
+// --------------------------------------------------
+// system_parameters_option
+// --------------------------------------------------
+//   applies the command-line option "option" to
+//   "parameters", along with its argument "value":
+//     -c <file>          loads the configuration file "file"
+//     -s <key>=<value>   sets a single parameter (as in -s np=6)
+//     -t <file>          maps the SRT table out of the table file "file"
+//   returns -1 on failure, and 1 (leaving "parameters"
+//   untouched) if "option" is none of these.
+// --------------------------------------------------
+char system_parameters_option(struct system_parameters* parameters, const char* option,
+							  const char* value) {
+
+	if (0 == strcmp(option, "-s"))
+		return system_parameters_assign(parameters, value);
+	if (0 == strcmp(option, "-t"))
+		return system_parameters_map_table(parameters, value);
+	if (0 != strcmp(option, "-c"))
+		return 1;
+
+	FILE* file = fopen(value, "r");
+	if (NULL == file) {
+		perror(value);
+		return -1;
+	}
+
+	const char result = system_parameters_load(parameters, file, value);
+	fclose(file);
+
+	return result;
+}
+
+// --------------------------------------------------
+// system_parameters_derive
+// --------------------------------------------------
+//   computes the dependent parameters of "parameters"
+//   out of the independent ones, which are checked to
+//   be within the reach of the simulator. returns -1 on
+//   failure.
+// --------------------------------------------------
+char system_parameters_derive(struct system_parameters* parameters) {
+
+	const unsigned short algorithm_m = parameters->algorithm_m;
+	const unsigned short algorithm_n = parameters->algorithm_n;
+	const unsigned short algorithm_Z = parameters->algorithm_Z;
+
+	if (0 == algorithm_m || 0 == algorithm_n) {
+		perror("m and n should be at least one.");
+		return -1;
+	}
+
+	// Z should be greater than or equal to m, as {S'} and 2{S'}
+	// are initialized to zero (see "simulate_problem").
+	if (algorithm_Z < algorithm_m) {
+		perror("Z should be greater than or equal to m.");
+		return -1;
+	}
+
+	// the digits lie within {-alpha, ..., +beta}, which should
+	// not exceed the largest digit of the radix.
+	if (parameters->algorithm_alpha >= (1 << algorithm_m) ||
+		parameters->algorithm_beta >= (1 << algorithm_m) || 0 == parameters->algorithm_beta) {
+		perror("alpha and beta should be less than the radix (and beta at least one).");
+		return -1;
+	}
+
+	if (0 == parameters->algorithm_ns ||
+		parameters->algorithm_np_fractional > parameters->algorithm_np) {
+		perror("ns should be at least one, and np_fractional at most np.");
+		return -1;
+	}
+
+	// dependent system parameters
+	// (following thesis notation)
+	const unsigned long iterations =
+		algorithm_n + (unsigned long) ceil((double) (algorithm_Z + 2) / algorithm_m);
+	const unsigned long delta =
+		(unsigned long) floor((double) algorithm_Z / algorithm_m) + 1;
+	//const unsigned short sigma = 
+	//	(unsigned short) floor((double) (algorithm_Z + algorithm_ns) / algorithm_m) + 1;
+	
+	//const unsigned short ma = algorithm_Z - algorithm_m * floor((double) algorithm_Z / algorithm_m);
+	const unsigned long mb =
+		algorithm_m * (unsigned long) ceil((double) algorithm_Z / algorithm_m) - algorithm_Z;
+
+	// processor_size denotes the width of the calculations in
+	// the processor which is also equal to the bit length of
+	// different variables/operands.
+	const unsigned long processor_size = (unsigned long) algorithm_m * algorithm_n;
+	// the widths of the hardware registers
+	const unsigned long register_S_size =
+		algorithm_m * iterations - algorithm_Z;
+	const unsigned long register_A_size =
+		algorithm_m * (iterations + algorithm_n - 2);
+	const unsigned long register_W_size =
+		algorithm_m * (iterations + algorithm_n + 2) + algorithm_Z + 1;
+
+	if (register_W_size > 0xFFFF) {
+		perror("The registers of the configuration are too wide to be simulated.");
+		return -1;
+	}
+
+	// To result in an exact square root we require that the
+	// choice of algorithm_m and algorithm_n result in an even
+	// value for "processor_size".
+	
+	// the plan for producing random operands and an exact 
+	// square root:
+	//
+	// A (multiplicand) = (1st random seed)^2
+	// B (multiplier)   = (2nd random seed)^2
+	//  A × B = (1st random seed × 2nd random seed)^2
+	// √A × B = (1st random seed × 2nd random seed)
+	//
+	// note: since both "A" and "B" are required to have a
+	// normalized size equal to "processor_size", and since
+	// both are formed by the means of squaring a number
+	// (doubling its bit length), we need "processor_size"
+	// to be even (divisible by two).
+	if ((1 & processor_size) != 0) {
+		perror("PROCESSOR BIT SIZE SHOULD BE AN EVEN VALUE");
+		return -1;
+	}
+
+	// a table that ignores the loose-bit signal needs results
+	// with a leading one, hence seeds with two leading ones
+	// (see "seed_leading_ones" in main.c).
+	if (!parameters->algorithm_loose_bit && processor_size < 4) {
+		perror("m × n should be at least four when loose_bit is cleared.");
+		return -1;
+	}
+
+	// the sample P is taken np_fractional + 1 bits below the
+	// position m × n + Z of the residual (see "simulate_problem").
+	if (parameters->algorithm_np_fractional >= processor_size + algorithm_Z) {
+		perror("np_fractional should be less than m × n + Z.");
+		return -1;
+	}
+
+	if (NULL == parameters->SRT_table && NULL == parameters->SRT_table_packed) {
+		perror("The configuration has no SRT table.");
+		return -1;
+	}
+
+	if (parameters->SRT_table_p0 >= parameters->SRT_table_dimensions[0]) {
+		perror("p0 should be one of the rows of the SRT table.");
+		return -1;
+	}
+
+	for (unsigned int i = 0; i < parameters->SRT_table_mappings_count; ++i) {
+		if (0 == parameters->SRT_table_mappings[i][0] || 0 == parameters->SRT_table_mappings[i][1] ||
+			parameters->SRT_table_mappings[i][1] > parameters->SRT_table_dimensions[1]) {
+			perror("The mappings of the SRT table should map to its columns (counted from one).");
+			return -1;
+		}
+	}
+
+	parameters->iterations = (unsigned short) iterations;
+	parameters->delta = (unsigned short) delta;
+	parameters->mb = (unsigned short) mb;
+	parameters->processor_size = (unsigned short) processor_size;
+	parameters->register_S_size = (unsigned short) register_S_size;
+	parameters->register_A_size = (unsigned short) register_A_size;
+	parameters->register_W_size = (unsigned short) register_W_size;
+
+	return 0;
+}
+
+// --------------------------------------------------
+// system_parameters_deallocate
+// --------------------------------------------------
+void system_parameters_deallocate(struct system_parameters* parameters) {
+
+	system_parameters_drop_table(parameters);
+}
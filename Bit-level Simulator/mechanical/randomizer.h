@@ -6,6 +6,8 @@
  *
  */
 
+#include <stdint.h>
+
 char initialize_randomizer() {
 	
 	int return_value = 0;
@@ -31,3 +33,58 @@ unsigned char random_bit() {
 	return (unsigned char) (rand() > (RAND_MAX >> 1) ? 1 : 0);
 }
 
+// a random generator whose state is held by its user rather
+// than by "rand", so that every thread can own a generator
+// of its own (a xorshift64* generator, whose bits are handed
+// out one at a time).
+typedef struct random_generator {
+	uint64_t state;
+	// the bits of the last output not handed out yet.
+	uint64_t bits;
+	unsigned char bit_count;
+} random_generator;
+
+// seeds "generator" with the stream number "stream" of "seed",
+// distinct streams giving unrelated sequences.
+void initialize_random_generator(struct random_generator* generator, 
+								 uint64_t seed, unsigned int stream) {
+	
+	// the state is scrambled by a splitmix64 step, as the
+	// generator should not start from a zero state.
+	uint64_t state = seed + (stream + 1) * 0x9E3779B97F4A7C15ULL;
+	state = (state ^ (state >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	state = (state ^ (state >> 27)) * 0x94D049BB133111EBULL;
+	state ^= state >> 31;
+	
+	generator->state = (state ? state : 1);
+	generator->bits = 0;
+	generator->bit_count = 0;
+}
+
+uint64_t random_generator_next(struct random_generator* generator) {
+	
+	generator->state ^= generator->state >> 12;
+	generator->state ^= generator->state << 25;
+	generator->state ^= generator->state >> 27;
+	
+	return generator->state * 0x2545F4914F6CDD1DULL;
+}
+
+// the counterpart of "random_bit" for "generator", where a NULL
+// generator stands for the global one of "rand".
+unsigned char random_generator_bit(struct random_generator* generator) {
+	
+	if (NULL == generator)
+		return random_bit();
+	
+	if (0 == generator->bit_count) {
+		generator->bits = random_generator_next(generator);
+		generator->bit_count = 64;
+	}
+	
+	const unsigned char bit = (unsigned char) (generator->bits >> 63);
+	generator->bits <<= 1;
+	--generator->bit_count;
+	
+	return bit;
+}
@@ -0,0 +1,168 @@
+/*
+ *  scheduler_library.h
+ *  mechanical project
+ *
+ *  a work-stealing scheduler that spreads a range of task
+ *  indices (such as the problems of a batch) over threads.
+ *
+ */
+
+#include <pthread.h>
+
+//
+// --- d o c u m e n t a t i o n --- s t a r t s --- h e r e
+//
+// BASIC CODE CONCEPTS:
+//
+// "work queue":
+//		is the range of task indices [next, end) owned by one worker thread. the range of all the
+//		tasks is split evenly among the queues of the workers to begin with.
+//
+// "work stealing":
+//		a worker takes its tasks a few at a time (WORK_CHUNK) out of the front of its own queue,
+//		and once the queue runs dry it steals the back half of the queue of another worker, so that
+//		the workers keep busy until all the queues are empty, whatever the cost of the tasks.
+//
+//
+// TECHNICAL DETAILS:
+//
+//  - locking:
+//		every queue has a lock of its own, which is held only for the few instructions needed to
+//		take or to steal a range, and which is contended only by thieves. the tasks themselves, and
+//		whatever they accumulate, are never guarded by a lock.
+//
+//  - termination:
+//		no task creates new ones, hence a worker that finds all the queues empty is done. the tasks
+//		still running on the other workers are the only work left at that point.
+//
+// --- d o c u m e n t a t i o n --- e n d s --- h e r e
+//
+
+// the number of tasks a worker takes out of its own queue
+// at once, which bounds the work left on a worker once the
+// others run out of work.
+#if !defined(WORK_CHUNK)
+#define WORK_CHUNK	64
+#endif
+
+typedef struct work_queue {
+	pthread_mutex_t lock;
+	unsigned long long next;
+	unsigned long long end;
+	// pads the queue to a cache line of its own, so that
+	// workers taking out of their own queues don't fight
+	// over a shared line.
+} __attribute__((aligned(64))) work_queue;
+
+// --------------------------------------------------
+// initialize_work_queues
+// --------------------------------------------------
+//   splits the tasks [0, task_count) evenly among the
+//   "queue_count" queues pointed by "queues".
+// --------------------------------------------------
+void initialize_work_queues(struct work_queue* queues, unsigned int queue_count,
+							unsigned long long task_count) {
+
+	assert(NULL != queues && queue_count > 0);
+	if (NULL == queues || 0 == queue_count) {
+		perror("Invalid queues passed to initialize_work_queues.");
+		return;
+	}
+
+	for (unsigned int i = 0; i < queue_count; ++i) {
+		pthread_mutex_init(&queues[i].lock, NULL);
+		queues[i].next = task_count * i / queue_count;
+		queues[i].end = task_count * (i + 1) / queue_count;
+	}
+}
+
+// --------------------------------------------------
+// work_queues_deallocate
+// --------------------------------------------------
+void work_queues_deallocate(struct work_queue* queues, unsigned int queue_count) {
+
+	for (unsigned int i = 0; i < queue_count; ++i)
+		pthread_mutex_destroy(&queues[i].lock);
+}
+
+// --------------------------------------------------
+// work_queue_take
+// --------------------------------------------------
+//   takes up to "count" tasks out of the front of
+//   "queue" into [*begin, *end), and returns the number
+//   of tasks taken.
+// --------------------------------------------------
+unsigned long long work_queue_take(struct work_queue* queue, unsigned long long count,
+								   unsigned long long* begin, unsigned long long* end) {
+
+	pthread_mutex_lock(&queue->lock);
+
+	if (count > queue->end - queue->next)
+		count = queue->end - queue->next;
+
+	*begin = queue->next;
+	*end = (queue->next += count);
+
+	pthread_mutex_unlock(&queue->lock);
+
+	return count;
+}
+
+// --------------------------------------------------
+// work_queue_steal
+// --------------------------------------------------
+//   moves the back half of the queue "victim" (rounded
+//   up) into the queue "thief", and returns the number
+//   of tasks stolen.
+//
+// notes:
+// - "thief" should be empty, and only its owner should
+//   add tasks to it.
+// --------------------------------------------------
+unsigned long long work_queue_steal(struct work_queue* thief, struct work_queue* victim) {
+
+	pthread_mutex_lock(&victim->lock);
+
+	const unsigned long long count = (victim->end - victim->next + 1) >> 1;
+	const unsigned long long end = victim->end;
+	victim->end -= count;
+
+	pthread_mutex_unlock(&victim->lock);
+
+	if (0 != count) {
+		pthread_mutex_lock(&thief->lock);
+		thief->next = end - count;
+		thief->end = end;
+		pthread_mutex_unlock(&thief->lock);
+	}
+
+	return count;
+}
+
+// --------------------------------------------------
+// work_next
+// --------------------------------------------------
+//   hands the worker "self" its next tasks [*begin,
+//   *end) out of "queues" (its own queue first, then
+//   the ones of the other "queue_count - 1" workers),
+//   and returns zero once there are no tasks left.
+// --------------------------------------------------
+unsigned long long work_next(struct work_queue* queues, unsigned int queue_count, unsigned int self,
+							 unsigned long long* begin, unsigned long long* end) {
+
+	if (0 != work_queue_take(&queues[self], WORK_CHUNK, begin, end))
+		return *end - *begin;
+
+	// the victims are visited in turn, starting from the
+	// next worker, which spreads the thieves over the
+	// victims.
+	for (unsigned int i = 1; i < queue_count; ++i) {
+		struct work_queue* victim = &queues[(self + i) % queue_count];
+
+		if (0 != work_queue_steal(&queues[self], victim) &&
+			0 != work_queue_take(&queues[self], WORK_CHUNK, begin, end))
+			return *end - *begin;
+	}
+
+	return 0;
+}
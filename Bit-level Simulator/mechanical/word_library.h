@@ -6,6 +6,43 @@
  *
  */
 
+#include <stdint.h>
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#if !defined(__has_builtin)
+#define __has_builtin(x) 0
+#endif
+
+// the checking policy of the word operations, selected at compile
+// time: the "verify" build (the default) validates the arguments of
+// every operation and tracks the integrity flags everywhere, while
+// the "throughput" build (WORD_POLICY_THROUGHPUT defined before this
+// file is included) drops the argument validation and only tracks
+// the flags that the simulator reads (see "data integrity" below).
+#if defined(WORD_POLICY_THROUGHPUT)
+#define WORD_CHECKED	0
+#else
+#define WORD_CHECKED	1
+#endif
+
+// validates a condition on the arguments of an operation, which
+// otherwise reports "message" and returns (with the value given
+// after it, if any).
+#if WORD_CHECKED
+#define WORD_VALIDATE(condition, message, ...) \
+	do { \
+		assert(condition); \
+		if (!(condition)) { \
+			perror(message); \
+			return __VA_ARGS__; \
+		} \
+	} while (0)
+#else
+#define WORD_VALIDATE(condition, message, ...)	((void) sizeof(condition))
+#endif
+
 //
 // --- d o c u m e n t a t i o n --- s t a r t s --- h e r e
 //
@@ -13,51 +50,76 @@
 //
 // "word":
 //		is a program memory structure, variable in size, that contains the raw contents of a hardware 
-//		register, as individual bits plus some additional information in the form of a header.
+//		register, as packed bits plus some additional information in the form of a header.
 //
 //
 // TECHNICAL DETAILS:
 //
 //  - storage:
-//		a word structure is stored as a header followed by a variable number of bytes, each containing
-//		either "1" or "0", using a little-endian order (less significant bits stored first, or in lower
-//		addresses). note that the choice of a little-endian ordering is intended to facilitate alignment
-//		as well as the manual implementation of additions/subtractions.
+//		a word structure is stored as a header followed by a variable number of 64-bit limbs, each
+//		packing 64 consecutive bits of the word, using a little-endian order (less significant bits
+//		stored first, or in lower addresses). bit "i" of the word is found in limb "i / 64", at the
+//		bit position "i % 64" of that limb. note that the choice of a little-endian ordering is
+//		intended to facilitate alignment as well as the manual implementation of additions/subtrac-
+//		tions, which can now operate on a whole machine word at a time.
+//
+//		the bits of the most-significant limb that lie beyond the width of the word (the padding
+//		bits) are always kept at zero, regardless of whether the word is signed or not. this way
+//		the "is_signed" flag can be toggled freely (e.g. for display purposes) without having to
+//		touch the limbs, and operations on whole limbs only need to mask the most-significant one.
 //
 //  - C definition:
 //		a word structure is defined as a pointer to the word_header structure, while making it implicitly
-//		understood that the header structure will be followed by a variable number of bytes, containing
-//		the value of individual bits in the word structure (also called the bit array). hence, a word 
-//		structure is composed of a header and a bit array.
+//		understood that the header structure will be followed by a variable number of limbs of the type
+//		"uint64_t", containing the bits of the word structure (also called the limb array). hence, a
+//		word structure is composed of a header and a limb array.
 //
-//		the length of the bit array, which represents the width of the word, is stored in the header in
-//		the field named "length", which is of the type "unsigned short".
+//		the width of the word in bits is stored in the header in the field named "length", which is
+//		of the type "unsigned short". the number of limbs is derived from it using "LIMB_COUNT".
 //
 //  - size:
 //		the size of the overall structure is equal to the size of the header "sizeof(word_header)", 
-//		plus the size of the bit array, which is equal to "word->length * sizeof(unsigned char)".
-//
-//  - accessing the bits:
-//		to access the bits of a word structure, we need to advance the pointer to skip the header, then
-//		to advance it just enough to address the target bit of the bit array, while explicitly casting
-//		the pointer type to "unsigned char*".
+//		plus the size of the limb array, which is equal to "LIMB_COUNT(word->length) * sizeof(uint64_t)".
+//		the header is padded to a multiple of 8 bytes, so that the limb array following it is always
+//		correctly aligned.
 //
-//		the shortest way to do this in the C programming language is using the line:
-//			((unsigned char*) (word + 1))[bit_index]
+//  - accessing the limbs:
+//		to access the limbs of a word structure, we need to advance the pointer to skip the header, 
+//		while explicitly casting the pointer type to "uint64_t*", which is what the macro named "LIMBS"
+//		does:
+//			LIMBS(word)[limb_index]
 //
-//		which is shorter (though less clear) than the more explicit form:
-//			((unsigned char*) ((void*) word + sizeof(struct word_header)))[bit_index]
-//
-//		yet in either case, it seems that the frequency of this operation necessitates that there be
-//		an even shorter (and less error prone) method of accessing the bits, which is why a dedicated
-//		macro named "BITS" was written for this purpose.
+//  - accessing the bits:
+//		individual bits are no longer directly addressable, instead they are read and written through
+//		the functions "word_getbit" and "word_setbit", which locate the limb holding the bit and mask
+//		the bit in or out of it.
 //
 //		--- d o c u m e n t a t i o n --- b r e a k s --- h e r e ---
 //
 
-// this macro provides an easy way to access the bit array
+// the width of a single limb in bits.
+#define LIMB_BITS	64
+
+// the number of limbs needed to store "length" bits.
+#define LIMB_COUNT(length)	(((length) + LIMB_BITS - 1) / LIMB_BITS)
+
+// this macro provides an easy way to access the limb array
 // following the header of a "word" structure.
-#define BITS(word)	((unsigned char*) ((void*) word + sizeof(struct word_header)))
+#define LIMBS(word)	((uint64_t*) ((void*) (word) + sizeof(struct word_header)))
+
+// the number of bytes taken by a word of "length" bits,
+// header included.
+#define WORD_BYTES(length)	(sizeof(struct word_header) + LIMB_COUNT(length) * sizeof(uint64_t))
+
+// where the memory of a word comes from (the "storage"
+// field of the header), which tells "word_deallocate"
+// whether there is anything to free.
+#define WORD_STORAGE_HEAP	0
+#define WORD_STORAGE_ARENA	1
+#define WORD_STORAGE_INLINE	2
+
+// the widest word that fits in a "small_word".
+#define SMALL_WORD_BITS	LIMB_BITS
 
 //
 //		--- d o c u m e n t a t i o n --- r e s u m e s --- h e r e ---
@@ -100,6 +162,11 @@
 //			in the case of a signed register, a left shift is only associated with an overflow if it
 //			caused a value other than that of the "sign bit" to be shifted out.
 //
+//		-- checking policy:
+//			the "throughput" build (see WORD_CHECKED) only tracks the overflow flag of the arithmetic
+//			operations (additions, multiplications and left shifts), as loads, negations and right
+//			shifts don't report overflows or underflows there.
+//
 // --- d o c u m e n t a t i o n --- e n d s --- h e r e
 //
 
@@ -116,8 +183,811 @@ typedef struct word_header {
 	// a flag indicating whether the quantity stored in the
 	// word bits is signed (helps determining an overflow).
 	unsigned char is_signed;
+	// where the memory of the word comes from (WORD_STORAGE_
+	// HEAP, WORD_STORAGE_ARENA or WORD_STORAGE_INLINE).
+	unsigned char storage;
+	// pads the header to 8 bytes, to keep the limb array that
+	// follows it aligned to the size of a limb.
+	unsigned char reserved[2];
 } *word_pointer;
 
+// a word arena is a single block of memory out of which
+// words are carved one after the other, and which is
+// emptied all at once (see "create_word_in").
+typedef struct word_arena {
+	// the block and its size in bytes.
+	unsigned char* block;
+	size_t capacity;
+	// the number of bytes handed out so far.
+	size_t used;
+} *word_arena_pointer;
+
+// a term of "word_op_shift_accumulate": the word, multiplied
+// by the (signed) integer "digit", is added (sign = +1) or
+// subtracted (sign = -1) after a left shift of "offset" 
+// bits. a plain term has a digit of one.
+typedef struct word_term {
+	struct word_header* word;
+	char sign;
+	unsigned short offset;
+	int digit;
+} word_term;
+
+// a small word is a word of up to SMALL_WORD_BITS bits 
+// whose single limb is held inline, right after the header,
+// just as it would be in a heap-allocated word, so that it
+// can be declared on the stack and passed to any of the
+// "word_op_*" functions (see "create_small_word").
+typedef struct small_word {
+	struct word_header header;
+	uint64_t limb;
+} small_word;
+
+// a carry-save word holds a value in a redundant form, as
+// the sum of two words of the same length (the sum and the
+// carry words, as left by a row of full adders), taken
+// modulo 2^length. the value is signed if the sum word is.
+// (see "word_op_carrysave_accumulate")
+typedef struct carrysave_word {
+	struct word_header* sum;
+	struct word_header* carry;
+} carrysave_word;
+
+
+// --------------------------------------------------
+// word_getbit
+// --------------------------------------------------
+unsigned char word_getbit(struct word_header* word, unsigned int index) {
+	return (unsigned char) 
+		((LIMBS(word)[index / LIMB_BITS] >> (index % LIMB_BITS)) & 1);
+}
+
+// --------------------------------------------------
+// word_setbit
+// --------------------------------------------------
+void word_setbit(struct word_header* word, unsigned int index, unsigned char bit) {
+	
+	const uint64_t mask = (uint64_t) 1 << (index % LIMB_BITS);
+	
+	if (bit)
+		LIMBS(word)[index / LIMB_BITS] |= mask;
+	else LIMBS(word)[index / LIMB_BITS] &= ~mask;
+}
+
+// --------------------------------------------------
+// word_clearpadding
+// --------------------------------------------------
+//   resets the padding bits of the most-significant
+//   limb (the ones beyond the width of the word) to
+//   zero, which is needed after any operation that
+//   works on whole limbs.
+// --------------------------------------------------
+void word_clearpadding(struct word_header* word) {
+	
+	if (0 != word->length % LIMB_BITS)
+		LIMBS(word)[LIMB_COUNT(word->length) - 1] &= 
+			((uint64_t) 1 << (word->length % LIMB_BITS)) - 1;
+}
+
+// --------------------------------------------------
+// word_signfill
+// --------------------------------------------------
+//   returns a limb filled with copies of the sign of
+//   the word (all ones for a negative signed word and
+//   all zeros otherwise), which is the value of every
+//   bit beyond the width of the word.
+// --------------------------------------------------
+uint64_t word_signfill(struct word_header* word) {
+	return (word->is_signed && word_getbit(word, word->length - 1) ? 
+			~(uint64_t) 0 : 0);
+}
+
+// --------------------------------------------------
+// word_readlimb
+// --------------------------------------------------
+//   returns the 64 bits of "word" starting at the bit
+//   position "offset", where positions below zero read
+//   as zeros and positions at or beyond the width of
+//   the word read as the sign (sign extension).
+// --------------------------------------------------
+uint64_t word_readlimb(struct word_header* word, int offset) {
+	
+	const int length = word->length;
+	const uint64_t fill = word_signfill(word);
+	
+	if (offset >= length)
+		return fill;
+	if (offset <= -LIMB_BITS)
+		return 0;
+	
+	uint64_t value = 0;
+	if (offset < 0) {
+		value = LIMBS(word)[0] << -offset;
+	} else {
+		const unsigned int index = offset / LIMB_BITS, 
+		                   shift = offset % LIMB_BITS;
+		
+		value = LIMBS(word)[index] >> shift;
+		if (0 != shift && index + 1 < (unsigned int) LIMB_COUNT(length))
+			value |= LIMBS(word)[index + 1] << (LIMB_BITS - shift);
+	}
+	
+	// the padding bits read as zeros, replace them (and
+	// any bit beyond) with the sign.
+	if (length - offset < LIMB_BITS)
+		value |= fill << (length - offset);
+	
+	return value;
+}
+
+// --------------------------------------------------
+// limb_addcarry
+// --------------------------------------------------
+//   returns the sum of two limbs and an incoming carry,
+//   while "carry" is updated with the outgoing carry.
+//   the add-with-carry instruction is used whenever the
+//   compiler exposes it.
+// --------------------------------------------------
+uint64_t limb_addcarry(uint64_t a, uint64_t b, unsigned char* carry) {
+	
+#if __has_builtin(__builtin_addcll)
+	unsigned long long carry_out = 0;
+	const uint64_t sum = __builtin_addcll(a, b, *carry, &carry_out);
+	*carry = (unsigned char) carry_out;
+	return sum;
+#elif defined(__x86_64__)
+	unsigned long long sum = 0;
+	*carry = _addcarry_u64(*carry, a, b, &sum);
+	return sum;
+#else
+	const uint64_t sum = a + b + *carry;
+	*carry = (sum < a || (*carry && sum == a));
+	return sum;
+#endif
+}
+
+// --------------------------------------------------
+// limb_subborrow
+// --------------------------------------------------
+//   returns the difference of two limbs minus an in-
+//   coming borrow, while "borrow" is updated with the
+//   outgoing borrow.
+// --------------------------------------------------
+uint64_t limb_subborrow(uint64_t a, uint64_t b, unsigned char* borrow) {
+	
+#if __has_builtin(__builtin_subcll)
+	unsigned long long borrow_out = 0;
+	const uint64_t difference = __builtin_subcll(a, b, *borrow, &borrow_out);
+	*borrow = (unsigned char) borrow_out;
+	return difference;
+#elif defined(__x86_64__)
+	unsigned long long difference = 0;
+	*borrow = _subborrow_u64(*borrow, a, b, &difference);
+	return difference;
+#else
+	const uint64_t difference = a - b - *borrow;
+	*borrow = (a < b || (*borrow && a == b));
+	return difference;
+#endif
+}
+
+
+// --------------------------------------------------
+// limb_rangemask
+// --------------------------------------------------
+//   returns the mask of the bits of the limb numbered
+//   "index" that fall within the bit range [from, to)
+//   of a word.
+// --------------------------------------------------
+uint64_t limb_rangemask(unsigned int index, unsigned int from, unsigned int to) {
+	
+	const unsigned int limb_start = index * LIMB_BITS;
+	
+	if (to <= limb_start || from >= limb_start + LIMB_BITS || from >= to)
+		return 0;
+	
+	const unsigned int low = (from > limb_start ? from - limb_start : 0),
+	                   high = (to < limb_start + LIMB_BITS ? to - limb_start : LIMB_BITS);
+	
+	uint64_t mask = ~(uint64_t) 0 << low;
+	if (high < LIMB_BITS)
+		mask &= ((uint64_t) 1 << high) - 1;
+	
+	return mask;
+}
+
+// --------------------------------------------------
+// limb_multiply
+// --------------------------------------------------
+//   returns the low limb of the 128-bit product of two
+//   limbs, while the high limb is stored at "high".
+// --------------------------------------------------
+uint64_t limb_multiply(uint64_t a, uint64_t b, uint64_t* high) {
+	
+#if defined(__SIZEOF_INT128__)
+	const unsigned __int128 product = (unsigned __int128) a * b;
+	*high = (uint64_t) (product >> LIMB_BITS);
+	return (uint64_t) product;
+#else
+	// split both limbs into 32-bit halves and combine the
+	// four partial products.
+	const uint64_t a0 = (uint32_t) a, a1 = a >> 32, 
+	               b0 = (uint32_t) b, b1 = b >> 32;
+	const uint64_t p00 = a0 * b0, p01 = a0 * b1, 
+	               p10 = a1 * b0, p11 = a1 * b1;
+	const uint64_t middle = (p00 >> 32) + (uint32_t) p01 + (uint32_t) p10;
+	*high = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+	return (middle << 32) | (uint32_t) p00;
+#endif
+}
+
+// --------------------------------------------------
+// karatsuba/toom-3 thresholds
+// --------------------------------------------------
+//   the number of limbs the shorter operand of a multi-
+//   plication should have, before the product is formed
+//   using Karatsuba's method or Toom-3 (Toom-Cook 3-way)
+//   rather than the schoolbook method.
+//
+// notes:
+// - both values can be tuned at runtime, the program
+//   "benchmark.c" measures where the crossovers fall on
+//   the machine at hand.
+// - both methods need operands of at least 4 limbs to
+//   split into smaller products, which is why smaller
+//   thresholds act like a threshold of 4.
+// --------------------------------------------------
+unsigned int word_karatsuba_threshold = 24;
+unsigned int word_toom3_threshold = 80;
+
+// --------------------------------------------------
+// limbs_negate
+// --------------------------------------------------
+//   replaces the limb array by its two's complement.
+// --------------------------------------------------
+void limbs_negate(uint64_t* limbs, unsigned int count) {
+	
+	unsigned char carry = 1;
+	for (unsigned int i = 0; i < count; ++i)
+		limbs[i] = limb_addcarry(~limbs[i], 0, &carry);
+}
+
+// --------------------------------------------------
+// limbs_addto
+// --------------------------------------------------
+//   adds the limb array "value" (value_count limbs) to 
+//   the limb array "accumulator" (accumulator_count 
+//   limbs, no less than value_count), and returns the
+//   carry out of the accumulator.
+// --------------------------------------------------
+unsigned char limbs_addto(uint64_t* accumulator, unsigned int accumulator_count,
+						  const uint64_t* value, unsigned int value_count) {
+	
+	unsigned char carry = 0;
+	unsigned int i = 0;
+	
+	for (; i < value_count; ++i)
+		accumulator[i] = limb_addcarry(accumulator[i], value[i], &carry);
+	for (; i < accumulator_count && carry; ++i)
+		accumulator[i] = limb_addcarry(accumulator[i], 0, &carry);
+	
+	return carry;
+}
+
+// --------------------------------------------------
+// limbs_subtractfrom
+// --------------------------------------------------
+//   the counterpart of "limbs_addto", which subtracts
+//   "value" from "accumulator" and returns the borrow.
+// --------------------------------------------------
+unsigned char limbs_subtractfrom(uint64_t* accumulator, unsigned int accumulator_count,
+								 const uint64_t* value, unsigned int value_count) {
+	
+	unsigned char borrow = 0;
+	unsigned int i = 0;
+	
+	for (; i < value_count; ++i)
+		accumulator[i] = limb_subborrow(accumulator[i], value[i], &borrow);
+	for (; i < accumulator_count && borrow; ++i)
+		accumulator[i] = limb_subborrow(accumulator[i], 0, &borrow);
+	
+	return borrow;
+}
+
+// --------------------------------------------------
+// limbs_load
+// --------------------------------------------------
+//   copies "count" limbs of "source" into "destination"
+//   and clears the rest of its "destination_count" limbs.
+// --------------------------------------------------
+void limbs_load(uint64_t* destination, unsigned int destination_count,
+				const uint64_t* source, unsigned int count) {
+	
+	memcpy(destination, source, count * sizeof(uint64_t));
+	memset(destination + count, 0, (destination_count - count) * sizeof(uint64_t));
+}
+
+// --------------------------------------------------
+// limbs_divide_small
+// --------------------------------------------------
+//   divides the unsigned limb array by a divisor below
+//   2^32, in place, and returns the remainder.
+// --------------------------------------------------
+uint32_t limbs_divide_small(uint64_t* limbs, unsigned int count, uint32_t divisor) {
+	
+	uint64_t remainder = 0;
+	
+	// long division, from the most-significant limb down and
+	// 32 bits at a time so that no 128-bit division is needed.
+	for (int i = count - 1; i >= 0; --i) {
+		const uint64_t high = (remainder << 32) | (limbs[i] >> 32);
+		remainder = high % divisor;
+		const uint64_t low = (remainder << 32) | (uint32_t) limbs[i];
+		remainder = low % divisor;
+		
+		limbs[i] = ((high / divisor) << 32) | (low / divisor);
+	}
+	
+	return (uint32_t) remainder;
+}
+
+// --------------------------------------------------
+// limbs_compare
+// --------------------------------------------------
+//   returns +1, 0 or -1 depending on whether the unsigned
+//   limb array "a" is greater than, equal to or less than
+//   "b", both being "count" limbs long.
+// --------------------------------------------------
+char limbs_compare(const uint64_t* a, const uint64_t* b, unsigned int count) {
+	
+	for (int i = count - 1; i >= 0; --i)
+		if (a[i] != b[i])
+			return (a[i] > b[i] ? +1 : -1);
+	
+	return 0;
+}
+
+// --------------------------------------------------
+// limbs_divide
+// --------------------------------------------------
+//   divides the unsigned limb array "a" (a_count limbs)
+//   by the non-zero unsigned limb array "b" (b_count 
+//   limbs), stores the quotient in "quotient" (a_count
+//   limbs) and the remainder in "remainder" (b_count 
+//   limbs), either of which may be NULL.
+//
+// notes:
+// - this is Knuth's algorithm D (long division with a
+//   normalized divisor and a corrected estimate of each
+//   quotient digit), carried out on 32-bit digits so 
+//   that no 128-bit division is needed, much like in
+//   "limbs_divide_small".
+// - the operands are split into 32-bit digits on the
+//   stack, hence no memory is allocated.
+// --------------------------------------------------
+void limbs_divide(uint64_t* quotient, uint64_t* remainder,
+				  const uint64_t* a, unsigned int a_count,
+				  const uint64_t* b, unsigned int b_count) {
+	
+	// the number of significant 32-bit digits of both operands.
+	unsigned int m = 2 * a_count, n = 2 * b_count;
+	uint32_t u[m + 1], v[n];
+	for (unsigned int i = 0; i < a_count; ++i) {
+		u[2 * i] = (uint32_t) a[i];
+		u[2 * i + 1] = (uint32_t) (a[i] >> 32);
+	}
+	for (unsigned int i = 0; i < b_count; ++i) {
+		v[2 * i] = (uint32_t) b[i];
+		v[2 * i + 1] = (uint32_t) (b[i] >> 32);
+	}
+	while (n > 0 && 0 == v[n - 1])
+		--n;
+	while (m > 0 && 0 == u[m - 1])
+		--m;
+	u[m] = 0;
+	
+	assert(n > 0);
+	
+	uint32_t q[m + 1];
+	memset(q, 0, sizeof(q));
+	
+	if (m < n) {
+		// the quotient is zero, and the remainder is "a".
+	} else if (1 == n) {
+		// a single-digit divisor needs no normalization.
+		uint64_t r = 0;
+		for (int i = m - 1; i >= 0; --i) {
+			const uint64_t current = (r << 32) | u[i];
+			q[i] = (uint32_t) (current / v[0]);
+			r = current % v[0];
+			u[i] = 0;
+		}
+		u[0] = (uint32_t) r;
+	} else {
+		// normalize, so that the most-significant digit of the
+		// divisor has its top bit set.
+		const unsigned int shift = __builtin_clz(v[n - 1]);
+		if (0 != shift) {
+			for (int i = n - 1; i > 0; --i)
+				v[i] = (v[i] << shift) | (v[i - 1] >> (32 - shift));
+			v[0] <<= shift;
+			u[m] = u[m - 1] >> (32 - shift);
+			for (int i = m - 1; i > 0; --i)
+				u[i] = (u[i] << shift) | (u[i - 1] >> (32 - shift));
+			u[0] <<= shift;
+		} else {
+			u[m] = 0;
+		}
+		
+		for (int j = m - n; j >= 0; --j) {
+			
+			// estimate the quotient digit from the top two digits
+			// of the current remainder, and correct it (at most
+			// twice) using the next digit of the divisor.
+			const uint64_t top = ((uint64_t) u[j + n] << 32) | u[j + n - 1];
+			uint64_t qhat = top / v[n - 1], rhat = top % v[n - 1];
+			
+			while (qhat >> 32 || 
+				   qhat * v[n - 2] > ((rhat << 32) | u[j + n - 2])) {
+				--qhat;
+				rhat += v[n - 1];
+				if (rhat >> 32)
+					break;
+			}
+			
+			// multiply and subtract.
+			int64_t borrow = 0;
+			uint64_t carry = 0;
+			for (unsigned int i = 0; i < n; ++i) {
+				const uint64_t product = qhat * v[i] + carry;
+				carry = product >> 32;
+				const int64_t difference = (int64_t) u[i + j] - borrow - (uint32_t) product;
+				u[i + j] = (uint32_t) difference;
+				borrow = (difference < 0 ? 1 : 0);
+			}
+			const int64_t difference = (int64_t) u[j + n] - borrow - (int64_t) carry;
+			u[j + n] = (uint32_t) difference;
+			
+			// the estimate was one too large, add the divisor back.
+			if (difference < 0) {
+				--qhat;
+				uint64_t sum = 0;
+				for (unsigned int i = 0; i < n; ++i) {
+					sum = (uint64_t) u[i + j] + v[i] + (sum >> 32);
+					u[i + j] = (uint32_t) sum;
+				}
+				u[j + n] += (uint32_t) (sum >> 32);
+			}
+			
+			q[j] = (uint32_t) qhat;
+		}
+		
+		// unnormalize the remainder.
+		if (0 != shift) {
+			for (unsigned int i = 0; i < n - 1; ++i)
+				u[i] = (u[i] >> shift) | (u[i + 1] << (32 - shift));
+			u[n - 1] >>= shift;
+		}
+		for (unsigned int i = n; i <= m; ++i)
+			u[i] = 0;
+	}
+	
+	if (NULL != quotient)
+		for (unsigned int i = 0; i < a_count; ++i)
+			quotient[i] = (2 * i < m + 1 ? q[2 * i] : 0) | 
+				((uint64_t) (2 * i + 1 < m + 1 ? q[2 * i + 1] : 0) << 32);
+	
+	if (NULL != remainder)
+		for (unsigned int i = 0; i < b_count; ++i)
+			remainder[i] = (2 * i < m + 1 ? u[2 * i] : 0) | 
+				((uint64_t) (2 * i + 1 < m + 1 ? u[2 * i + 1] : 0) << 32);
+}
+
+// --------------------------------------------------
+// limbs_multiply_schoolbook
+// --------------------------------------------------
+//   stores the product of the unsigned limb arrays "a"
+//   (a_count limbs) and "b" (b_count limbs) in "product"
+//   which should have room for (a_count + b_count) limbs
+//   and should not overlap with either operand.
+//
+// notes:
+// - every row of 64×64→128-bit partial products is 
+//   accumulated at once through a single carry limb.
+// --------------------------------------------------
+void limbs_multiply_schoolbook(uint64_t* product, 
+							   const uint64_t* a, unsigned int a_count,
+							   const uint64_t* b, unsigned int b_count) {
+	
+	memset(product, 0, (a_count + b_count) * sizeof(uint64_t));
+	
+	for (unsigned int i = 0; i < a_count; ++i) {
+		
+		uint64_t carry = 0;
+		if (0 == a[i]) {
+			product[i + b_count] = 0;
+			continue;
+		}
+		
+		for (unsigned int j = 0; j < b_count; ++j) {
+#if defined(__SIZEOF_INT128__)
+			const unsigned __int128 term = 
+				(unsigned __int128) a[i] * b[j] + product[i + j] + carry;
+			
+			product[i + j] = (uint64_t) term;
+			carry = (uint64_t) (term >> LIMB_BITS);
+#else
+			uint64_t high = 0;
+			unsigned char carry_bit = 0;
+			uint64_t low = limb_multiply(a[i], b[j], &high);
+			
+			low = limb_addcarry(low, product[i + j], &carry_bit);
+			high += carry_bit;
+			carry_bit = 0;
+			product[i + j] = limb_addcarry(low, carry, &carry_bit);
+			carry = high + carry_bit;
+#endif
+		}
+		
+		product[i + b_count] = carry;
+	}
+}
+
+void limbs_multiply(uint64_t* product, 
+					const uint64_t* a, unsigned int a_count,
+					const uint64_t* b, unsigned int b_count);
+
+// --------------------------------------------------
+// limbs_multiply_karatsuba
+// --------------------------------------------------
+//   the counterpart of "limbs_multiply_schoolbook" that
+//   uses Karatsuba's method, for operands where a_count
+//   >= b_count > a_count / 2.
+//
+// notes:
+// - with a = a1·X + a0 and b = b1·X + b0 (X = 2^(64·h)),
+//   three half-size products are formed:
+//     z0 = a0·b0, z2 = a1·b1, and
+//     z1 = (a0 + a1)·(b0 + b1) - z0 - z2
+//   so that a·b = z2·X² + z1·X + z0.
+// --------------------------------------------------
+void limbs_multiply_karatsuba(uint64_t* product, 
+							  const uint64_t* a, unsigned int a_count,
+							  const uint64_t* b, unsigned int b_count) {
+	
+	const unsigned int h = (a_count + 1) / 2,
+	                   product_count = a_count + b_count;
+	const unsigned int a1_count = a_count - h,
+	                   b0_count = (b_count < h ? b_count : h),
+	                   b1_count = b_count - b0_count;
+	
+	// z0 and z2 are formed directly at their final positions.
+	memset(product, 0, product_count * sizeof(uint64_t));
+	limbs_multiply(product, a, h, b, b0_count);
+	if (0 != b1_count)
+		limbs_multiply(product + 2 * h, a + h, a1_count, b + h, b1_count);
+	
+	// the sums of the halves are one limb wider than a half.
+	uint64_t a_sum[h + 1], b_sum[h + 1], z1[2 * h + 2];
+	
+	limbs_load(a_sum, h + 1, a, h);
+	a_sum[h] = limbs_addto(a_sum, h, a + h, a1_count);
+	
+	limbs_load(b_sum, h + 1, b, b0_count);
+	b_sum[h] = (0 != b1_count ? limbs_addto(b_sum, h, b + h, b1_count) : 0);
+	
+	limbs_multiply(z1, a_sum, h + 1, b_sum, h + 1);
+	
+	limbs_subtractfrom(z1, 2 * h + 2, product, h + b0_count);
+	if (0 != b1_count)
+		limbs_subtractfrom(z1, 2 * h + 2, product + 2 * h, product_count - 2 * h);
+	
+	// the limbs of z1 beyond the product are zeros.
+	const unsigned int z1_count = (2 * h + 2 < product_count - h ? 
+								   2 * h + 2 : product_count - h);
+	limbs_addto(product + h, product_count - h, z1, z1_count);
+}
+
+// --------------------------------------------------
+// limbs_multiply_signed
+// --------------------------------------------------
+//   multiplies two signed (two's complement) limb arrays
+//   of "count" limbs, whose magnitudes fit in count - 1
+//   limbs, into the 2·count - 2 limbs of "product" (two's
+//   complement as well). used by Toom-3 for multiplying
+//   its evaluation points.
+// --------------------------------------------------
+void limbs_multiply_signed(uint64_t* product, 
+						   const uint64_t* a, const uint64_t* b, 
+						   unsigned int count) {
+	
+	const unsigned char a_negative = a[count - 1] >> (LIMB_BITS - 1),
+	                    b_negative = b[count - 1] >> (LIMB_BITS - 1);
+	uint64_t a_magnitude[count], b_magnitude[count];
+	
+	limbs_load(a_magnitude, count, a, count);
+	limbs_load(b_magnitude, count, b, count);
+	if (a_negative)
+		limbs_negate(a_magnitude, count);
+	if (b_negative)
+		limbs_negate(b_magnitude, count);
+	
+	limbs_multiply(product, a_magnitude, count - 1, b_magnitude, count - 1);
+	
+	if (a_negative != b_negative)
+		limbs_negate(product, 2 * count - 2);
+}
+
+// --------------------------------------------------
+// limbs_multiply_toom3
+// --------------------------------------------------
+//   the counterpart of "limbs_multiply_karatsuba" that
+//   uses the Toom-3 (Toom-Cook 3-way) method.
+//
+// notes:
+// - each operand is split in three parts of k limbs,
+//   as the coefficients of a polynomial in X = 2^(64·k)
+//   (a = a2·X² + a1·X + a0), and the product polynomial
+//   is evaluated at the points 0, 1, -1, -2 and infinity
+//   using five products of about a third of the size.
+// - the coefficients of the product are then recovered
+//   using Bodrato's interpolation sequence, in two's
+//   complement on 2k + 2 limbs, which is wide enough for
+//   all the intermediate (possibly negative) values.
+// --------------------------------------------------
+void limbs_multiply_toom3(uint64_t* product, 
+						  const uint64_t* a, unsigned int a_count,
+						  const uint64_t* b, unsigned int b_count) {
+	
+	const unsigned int k = (a_count + 2) / 3,
+	                   e = k + 2,          // width of the evaluations
+	                   w = 2 * k + 2,      // width of the coefficients
+	                   product_count = a_count + b_count;
+	
+	// the three parts of each operand, zero-extended to the
+	// width of the evaluations.
+	uint64_t a_part[3][e], b_part[3][e];
+	for (unsigned int i = 0; i < 3; ++i) {
+		const unsigned int a_start = (i * k < a_count ? i * k : a_count),
+		                   b_start = (i * k < b_count ? i * k : b_count);
+		const unsigned int a_end = (a_start + k < a_count ? a_start + k : a_count),
+		                   b_end = (b_start + k < b_count ? b_start + k : b_count);
+		
+		limbs_load(a_part[i], e, a + a_start, a_end - a_start);
+		limbs_load(b_part[i], e, b + b_start, b_end - b_start);
+	}
+	
+	// evaluation at 1, -1 and -2 (two's complement on e limbs)
+	//   p(1)  = p0 + p1 + p2
+	//   p(-1) = p0 - p1 + p2
+	//   p(-2) = 2·(p(-1) + p2) - p0
+	uint64_t a_at[3][e], b_at[3][e];
+	for (unsigned int i = 0; i < 2; ++i) {
+		uint64_t (*part)[e] = (0 == i ? a_part : b_part);
+		uint64_t (*at)[e] = (0 == i ? a_at : b_at);
+		
+		limbs_load(at[0], e, part[0], e);
+		limbs_addto(at[0], e, part[2], e);
+		limbs_load(at[1], e, at[0], e);
+		limbs_addto(at[0], e, part[1], e);
+		limbs_subtractfrom(at[1], e, part[1], e);
+		
+		limbs_load(at[2], e, at[1], e);
+		limbs_addto(at[2], e, part[2], e);
+		limbs_addto(at[2], e, at[2], e);
+		limbs_subtractfrom(at[2], e, part[0], e);
+	}
+	
+	// the products at 0 and infinity are unsigned, and the ones
+	// at 1, -1 and -2 are signed (all on w limbs).
+	uint64_t r0[w], r1[w], r2[w], r3[w], r4[w], r_m1[w], r_m2[w];
+	
+	limbs_multiply(r0, a_part[0], k, b_part[0], k);
+	limbs_multiply(r4, a_part[2], k, b_part[2], k);
+	r0[w - 2] = r0[w - 1] = r4[w - 2] = r4[w - 1] = 0;
+	
+	limbs_multiply_signed(r1, a_at[0], b_at[0], e);
+	limbs_multiply_signed(r_m1, a_at[1], b_at[1], e);
+	limbs_multiply_signed(r_m2, a_at[2], b_at[2], e);
+	
+	// interpolation:
+	//   r3 = (r(-2) - r(1)) / 3
+	//   r1 = (r(1) - r(-1)) / 2
+	//   r2 = r(-1) - r(0)
+	//   r3 = (r2 - r3) / 2 + 2·r(inf)
+	//   r2 = r2 + r1 - r(inf)
+	//   r1 = r1 - r3
+	limbs_load(r3, w, r_m2, w);
+	limbs_subtractfrom(r3, w, r1, w);
+	{
+		// exact (signed) division by three
+		const unsigned char negative = r3[w - 1] >> (LIMB_BITS - 1);
+		if (negative)
+			limbs_negate(r3, w);
+		limbs_divide_small(r3, w, 3);
+		if (negative)
+			limbs_negate(r3, w);
+	}
+	
+	limbs_subtractfrom(r1, w, r_m1, w);
+	for (unsigned int i = 0; i < w; ++i)
+		r1[i] = (r1[i] >> 1) | (i + 1 < w ? r1[i + 1] << (LIMB_BITS - 1) : r1[i] & ((uint64_t) 1 << (LIMB_BITS - 1)));
+	
+	limbs_load(r2, w, r_m1, w);
+	limbs_subtractfrom(r2, w, r0, w);
+	
+	limbs_negate(r3, w);
+	limbs_addto(r3, w, r2, w);
+	for (unsigned int i = 0; i < w; ++i)
+		r3[i] = (r3[i] >> 1) | (i + 1 < w ? r3[i + 1] << (LIMB_BITS - 1) : r3[i] & ((uint64_t) 1 << (LIMB_BITS - 1)));
+	limbs_addto(r3, w, r4, w);
+	limbs_addto(r3, w, r4, w);
+	
+	limbs_addto(r2, w, r1, w);
+	limbs_subtractfrom(r2, w, r4, w);
+	
+	limbs_subtractfrom(r1, w, r3, w);
+	
+	// recomposition: a·b = r4·X⁴ + r3·X³ + r2·X² + r1·X + r0, 
+	// where all the coefficients are now positive, and their
+	// limbs beyond the product are zeros.
+	uint64_t* coefficients[5] = {r0, r1, r2, r3, r4};
+	
+	memset(product, 0, product_count * sizeof(uint64_t));
+	for (unsigned int i = 0; i < 5 && i * k < product_count; ++i)
+		limbs_addto(product + i * k, product_count - i * k, coefficients[i], 
+					(w < product_count - i * k ? w : product_count - i * k));
+}
+
+// --------------------------------------------------
+// limbs_multiply
+// --------------------------------------------------
+//   stores the product of the unsigned limb arrays "a"
+//   (a_count limbs) and "b" (b_count limbs) in "product"
+//   which should have room for (a_count + b_count) limbs
+//   and should not overlap with either operand.
+//
+// notes:
+// - the method is chosen according to the size of the
+//   shorter operand (see "word_karatsuba_threshold"),
+//   whereas operands that differ a lot in size are cut
+//   into pieces of the size of the shorter one first.
+// --------------------------------------------------
+void limbs_multiply(uint64_t* product, 
+					const uint64_t* a, unsigned int a_count,
+					const uint64_t* b, unsigned int b_count) {
+	
+	// make "a" the longer operand.
+	if (a_count < b_count) {
+		const uint64_t* swapped = a;
+		const unsigned int swapped_count = a_count;
+		a = b; a_count = b_count;
+		b = swapped; b_count = swapped_count;
+	}
+	
+	if (b_count < 4 || b_count < word_karatsuba_threshold) {
+		limbs_multiply_schoolbook(product, a, a_count, b, b_count);
+	} else if (a_count >= 2 * b_count) {
+		
+		// unbalanced operands: multiply "b" by one piece of "a"
+		// at a time, and accumulate the partial products.
+		uint64_t piece_product[2 * b_count];
+		
+		memset(product, 0, (a_count + b_count) * sizeof(uint64_t));
+		for (unsigned int offset = 0; offset < a_count; offset += b_count) {
+			const unsigned int piece_count = (a_count - offset < b_count ? 
+											  a_count - offset : b_count);
+			
+			limbs_multiply(piece_product, a + offset, piece_count, b, b_count);
+			limbs_addto(product + offset, a_count + b_count - offset, 
+						piece_product, piece_count + b_count);
+		}
+	} else if (b_count >= word_toom3_threshold) {
+		limbs_multiply_toom3(product, a, a_count, b, b_count);
+	} else {
+		limbs_multiply_karatsuba(product, a, a_count, b, b_count);
+	}
+}
 
 // --------------------------------------------------
 // create_word
@@ -125,10 +995,9 @@ typedef struct word_header {
 struct word_header* create_word(unsigned short length) {
 	
 	// calculate the number of bytes needed to store the whole
-	// structure, which includes both the header and the bit
+	// structure, which includes both the header and the limb
 	// array.
-	const size_t byte_count = sizeof(struct word_header) + 
-	length * sizeof(unsigned char);
+	const size_t byte_count = WORD_BYTES(length);
 	struct word_header* word = NULL;
 	
 	// allocate this number of bytes.
@@ -140,7 +1009,7 @@ struct word_header* create_word(unsigned short length) {
 		return NULL;
 	}
 	
-	// initialize the fields properly, and reset bit array
+	// initialize the fields properly, and reset limb array
 	// to zero.
 	memset((void*) word, 0, byte_count);
 	word->length = length;
@@ -155,19 +1024,17 @@ struct word_header* create_word(unsigned short length) {
 // --------------------------------------------------
 struct word_header* create_word_duplicate(struct word_header* source) {
 	
-	assert(NULL != source && source->length > 0);
-	if (NULL == source || 0 == source->length) {
-		perror("Invalid source word passed to create_word_duplicate.");
-		return NULL;
-	}
+	WORD_VALIDATE(NULL != source && source->length > 0, 
+				  "Invalid source word passed to create_word_duplicate.", NULL);
 	
 	struct word_header* result = create_word(source->length);
 	if (NULL == result)
 		return NULL;
 	
-	const size_t byte_count = sizeof(struct word_header) + 
-	sizeof(unsigned char) * source->length;
-	memcpy((void*) result, (void*) source, byte_count);
+	memcpy((void*) result, (void*) source, WORD_BYTES(source->length));
+	
+	// the duplicate has storage of its own.
+	result->storage = WORD_STORAGE_HEAP;
 	
 	return result;
 }
@@ -183,36 +1050,222 @@ void word_deallocate(struct word_header* word) {
 		return;
 	}
 	
+	// words carved out of an arena are freed along with it,
+	// and small words live in storage of their own.
+	if (WORD_STORAGE_HEAP != word->storage)
+		return;
+	
 	free((void*) word);
 }
 
 // --------------------------------------------------
-// word_randomize
+// create_small_word
 // --------------------------------------------------
-//   stores a random, yet-normalized value in the bits
-//   of the structure linked by "word".
+//   the counterpart of "create_word" for a word of no
+//   more than SMALL_WORD_BITS bits, which lives in the
+//   caller-provided "storage" (typically a local 
+//   variable) instead of the heap.
 //
 // notes:
-// - to result in a different sequence of random values
-//   each time the program is executed, the function
-//   "initialize_randomizer" should be called at least
-//   once prior to calling this function.
+// - the word stays valid as long as "storage" does, 
+//   passing it to "word_deallocate" does nothing.
 // --------------------------------------------------
-void word_randomize(struct word_header* word) {
+struct word_header* create_small_word(struct small_word* storage, unsigned short length) {
 	
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word passed to word_randomize.");
-		return ;
+	WORD_VALIDATE(NULL != storage, "NULL storage passed to create_small_word.", NULL);
+	
+	WORD_VALIDATE(length <= SMALL_WORD_BITS, 
+				  "A small word can't be wider than SMALL_WORD_BITS (create_small_word).", NULL);
+	
+	memset((void*) storage, 0, sizeof(struct small_word));
+	storage->header.length = length;
+	storage->header.storage = WORD_STORAGE_INLINE;
+	
+	return &storage->header;
+}
+
+// --------------------------------------------------
+// create_carrysave_word
+// --------------------------------------------------
+//   creates the sum and the carry words of a carry-save 
+//   word of "length" bits in "storage", which then holds
+//   the value zero (unsigned).
+//
+// warning:
+// - both words are dynamically allocated and hence should
+//   be freed manually using "carrysave_deallocate".
+// --------------------------------------------------
+struct carrysave_word* create_carrysave_word(struct carrysave_word* storage, unsigned short length) {
+	
+	WORD_VALIDATE(NULL != storage, "NULL storage passed to create_carrysave_word.", NULL);
+	
+	storage->sum = create_word(length);
+	storage->carry = create_word(length);
+	if (NULL == storage->sum || NULL == storage->carry) {
+		free((void*) storage->sum);
+		free((void*) storage->carry);
+		return NULL;
+	}
+	
+	return storage;
+}
+
+// --------------------------------------------------
+// carrysave_deallocate
+// --------------------------------------------------
+void carrysave_deallocate(struct carrysave_word* word) {
+	
+	assert(NULL != word);
+	if (NULL == word) {
+		perror("NULL pointer passed to carrysave_deallocate.");
+		return;
+	}
+	
+	word_deallocate(word->sum);
+	word_deallocate(word->carry);
+}
+
+// --------------------------------------------------
+// create_word_arena
+// --------------------------------------------------
+//   creates an arena able to hold "capacity" bytes of
+//   words, see "WORD_BYTES" for the size of a word.
+//
+// warning:
+// - the arena returned by this function call is
+//   dynamically allocated and hence should be freed 
+//   manually using "arena_deallocate" to avoid memory
+//   leaks.
+// --------------------------------------------------
+struct word_arena* create_word_arena(size_t capacity) {
+	
+	struct word_arena* arena = malloc(sizeof(struct word_arena));
+	
+	assert(NULL != arena);
+	if (NULL == arena) {
+		perror("Couldn't allocate memory for a word arena.");
+		return NULL;
+	}
+	
+	arena->block = malloc(capacity);
+	
+	assert(NULL != arena->block || 0 == capacity);
+	if (NULL == arena->block && 0 != capacity) {
+		perror("Couldn't allocate memory for the block of a word arena.");
+		free((void*) arena);
+		return NULL;
+	}
+	
+	arena->capacity = capacity;
+	arena->used = 0;
+	
+	return arena;
+}
+
+// --------------------------------------------------
+// create_word_in
+// --------------------------------------------------
+//   the counterpart of "create_word" that takes the word
+//   out of "arena" instead of allocating it on its own,
+//   which only costs advancing a pointer.
+//
+// notes:
+// - the word stays valid until "arena_reset" is called,
+//   passing it to "word_deallocate" does nothing.
+// --------------------------------------------------
+struct word_header* create_word_in(struct word_arena* arena, unsigned short length) {
+	
+	WORD_VALIDATE(NULL != arena, "NULL arena passed to create_word_in.", NULL);
+	
+	// the size of every word is a multiple of 8 bytes, so 
+	// the words in the block stay aligned one after the 
+	// other.
+	const size_t byte_count = WORD_BYTES(length);
+	
+	assert(arena->used + byte_count <= arena->capacity);
+	if (arena->used + byte_count > arena->capacity) {
+		perror("The word arena is out of space (create_word_in).");
+		return NULL;
+	}
+	
+	struct word_header* word = (struct word_header*) (arena->block + arena->used);
+	arena->used += byte_count;
+	
+	memset((void*) word, 0, byte_count);
+	word->length = length;
+	word->storage = WORD_STORAGE_ARENA;
+	
+	return word;
+}
+
+// --------------------------------------------------
+// arena_reset
+// --------------------------------------------------
+//   releases all the words taken out of "arena" at once,
+//   so that its block can be reused.
+// --------------------------------------------------
+void arena_reset(struct word_arena* arena) {
+	
+	WORD_VALIDATE(NULL != arena, "NULL arena passed to arena_reset.");
+	
+	arena->used = 0;
+}
+
+// --------------------------------------------------
+// arena_deallocate
+// --------------------------------------------------
+void arena_deallocate(struct word_arena* arena) {
+	
+	assert(NULL != arena);
+	if (NULL == arena) {
+		perror("NULL arena passed to arena_deallocate.");
+		return;
 	}
 	
+	free((void*) arena->block);
+	free((void*) arena);
+}
+
+// --------------------------------------------------
+// word_clear
+// --------------------------------------------------
+//   stores zero in "word" and clears its overflow and
+//   underflow flags, so that it can be reused as if it
+//   was just created (its length, signedness and storage
+//   are kept).
+// --------------------------------------------------
+void word_clear(struct word_header* word) {
+	
+	WORD_VALIDATE(NULL != word, "NULL word passed to word_clear.");
+	
+	memset((void*) LIMBS(word), 0, LIMB_COUNT(word->length) * sizeof(uint64_t));
+	word->overflow = 0;
+	word->underflow = 0;
+}
+
+// --------------------------------------------------
+// word_randomize_with
+// --------------------------------------------------
+//   stores a random, yet-normalized value in the bits
+//   of the structure linked by "word", drawing the bits
+//   from "generator" (see "random_generator_bit").
+//
+// notes:
+// - a NULL generator stands for the global one of 
+//   "rand", which is shared by all the threads.
+// --------------------------------------------------
+void word_randomize_with(struct word_header* word, struct random_generator* generator) {
+	
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word passed to word_randomize_with.");
+	
 	// for an unsigned word, the most-significant bit is one
 	// for a signed word, on the other hand, the most-signi-
 	// ficant bit (the sign bit) is random whereas the second
 	// bit is opposite to the sign bit.
 	unsigned char previous_bit;
-	do previous_bit = random_bit();
-	while (random_bit() == previous_bit);
+	do previous_bit = random_generator_bit(generator);
+	while (random_generator_bit(generator) == previous_bit);
 	
 	// following the previous loop we'll have a random sequence
 	// of two different bit values (01 or 10), where previous_
@@ -220,69 +1273,95 @@ void word_randomize(struct word_header* word) {
 	
 	int i = word->length - 1;
 	if (word->is_signed) {
-		BITS(word)[i--] = previous_bit;
-		BITS(word)[i--] = (previous_bit ? 0 : 1);
+		word_setbit(word, i--, previous_bit);
+		word_setbit(word, i--, (previous_bit ? 0 : 1));
 	} else {
-		BITS(word)[i--] = 1;
+		word_setbit(word, i--, 1);
 		
 		if (previous_bit)
-			BITS(word)[i--] = 0;
+			word_setbit(word, i--, 0);
 	}
 
 	while (i >= 0)
-		BITS(word)[i--] = random_bit();
+		word_setbit(word, i--, random_generator_bit(generator));
+}
+
+// --------------------------------------------------
+// word_randomize
+// --------------------------------------------------
+//   stores a random, yet-normalized value in the bits
+//   of the structure linked by "word".
+//
+// notes:
+// - to result in a different sequence of random values
+//   each time the program is executed, the function
+//   "initialize_randomizer" should be called at least
+//   once prior to calling this function.
+// --------------------------------------------------
+void word_randomize(struct word_header* word) {
+	
+	word_randomize_with(word, NULL);
 }
 
 
 // --------------------------------------------------
 // word_op_negate
 // --------------------------------------------------
+//   replaces the signed "word" by its two's complement,
+//   inverting its limbs and adding one to them with a
+//   carry (see "limbs_negate").
+//
+// notes:
+// - the overflow flag is set for the most-negative 
+//   value, which is its own two's complement.
+// --------------------------------------------------
 void word_op_negate(struct word_header* word) {
 	
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word passed to word_op_negate.");
-		return ;
-	}
-	assert(word->is_signed);
-	if (!word->is_signed) {
-		perror("an unsigned word cannot be negated (word_op_negate).");
-		return ;
-	}
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word passed to word_op_negate.");
+	WORD_VALIDATE(word->is_signed, "an unsigned word cannot be negated (word_op_negate).");
 	
-	// compute the sign bit, but don't alter it yet
-	unsigned char final_sign = (BITS(word)[word->length - 1] ? 0 : 1);
-
-	// to negate a signed number we invert all the bits
-	// and then add one.
-	int sum = 1;
-	for (unsigned int i = 0; i < word->length; ++i) {
-		
-		// remember that the most-significant bit of the
-		// result is the sign bit, and hence should not
-		// be involved in the inversion/addition process.
-		// also remember that the word should either be
-		// padded with 0's or 1's depending on the original 
-		// sign (positive or minus, respectively).
-		unsigned char source_bit = BITS(word)[word->length - 1];
-		if (i < word->length)
-			source_bit = BITS(word)[i];
-		
-		// add the initial 1-valued sum to the inverted
-		// word bits
-		sum += (source_bit ? 0 : 1);
-		
-		if (i == word->length - 1 && (sum & 1) != final_sign) {
-			word->overflow = 1;
-		}
+	const unsigned char negative = (0 != word_signfill(word) ? 1 : 0);
+	
+	limbs_negate(LIMBS(word), LIMB_COUNT(word->length));
+	
+	// the inversion spills ones into the padding bits.
+	word_clearpadding(word);
+	
+	if (WORD_CHECKED && negative && 0 != word_signfill(word))
+		word->overflow = 1;
+}
 
-		if (i < word->length - 1)
-			BITS(word)[i] = sum & 1;
-		else if (i == word->length - 1)
-			BITS(word)[i] = final_sign;
-		
-		sum >>= 1;
-	}
+// --------------------------------------------------
+// word_magnitude
+// --------------------------------------------------
+//   stores the magnitude (absolute value) of "word" in 
+//   the caller-provided limb array "limbs", which should
+//   have room for LIMB_COUNT(word->length) limbs, and
+//   returns the sign of the word (1 for negative).
+//
+// notes:
+// - a negative word is negated on the fly while its
+//   limbs are read, hence no memory is allocated, and
+//   "limbs" may be the limbs of "word" itself.
+// - the magnitude of the most-negative word has its
+//   top bit (the sign bit position) set, just as the 
+//   magnitude of any other word fits the word length.
+// --------------------------------------------------
+unsigned char word_magnitude(uint64_t* limbs, struct word_header* word) {
+	
+	const unsigned int count = LIMB_COUNT(word->length);
+	const unsigned char sign = (0 != word_signfill(word) ? 1 : 0);
+	
+	unsigned char carry = 1;
+	for (unsigned int i = 0; i < count; ++i)
+		limbs[i] = (sign ? limb_addcarry(~LIMBS(word)[i], 0, &carry) : LIMBS(word)[i]);
+	
+	// the negation spills ones into the padding bits.
+	if (sign)
+		limbs[count - 1] &= limb_rangemask(count - 1, 0, word->length);
+	
+	return sign;
 }
 
 // --------------------------------------------------
@@ -294,45 +1373,101 @@ void word_op_negate(struct word_header* word) {
 //   dynamically allocated using "create_word" and
 //   hence should be freed manually using "word_deall
 //   -ocate" to avoid memory leaks.
+// - the library itself uses "word_magnitude" instead,
+//   which works on caller-provided limbs.
 // --------------------------------------------------
 struct word_header* word_op_abs(struct word_header* word) {
 	
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word passed to word_op_abs.");
-		return NULL;
-	}
+	WORD_VALIDATE(NULL != word && word->length > 0, "Invalid word passed to word_op_abs.", NULL);
+	
+	struct word_header* result = create_word_duplicate(word);
+	
+	// if the word was intended to convey a signed amount and
+	// had a sign bit of one (negative), then invert and add
+	// one to get the amplitude or the absolute value.
+	if (NULL != result)
+		word_magnitude(LIMBS(result), word);
+	
+	return result;
+}
+
+// --------------------------------------------------
+// limbs_readdigit
+// --------------------------------------------------
+//   returns the "index"'th digit to the radix "2^bits_
+//   per_digit" of the "length"-bit number held in the
+//   limb array "limbs", whose padding bits are zero.
+// --------------------------------------------------
+unsigned int limbs_readdigit(const uint64_t* limbs, unsigned int length,
+							 unsigned int index, unsigned char bits_per_digit) {
+	
+	const unsigned int position = index * bits_per_digit,
+	                   limb = position / LIMB_BITS,
+	                   shift = position % LIMB_BITS;
+	
+	uint64_t value = limbs[limb] >> shift;
+	if (0 != shift && shift + bits_per_digit > LIMB_BITS && limb + 1 < LIMB_COUNT(length))
+		value |= limbs[limb + 1] << (LIMB_BITS - shift);
+	
+	return (unsigned int) (value & (((uint64_t) 1 << bits_per_digit) - 1));
+}
+
+// --------------------------------------------------
+// word_makelist_into
+// --------------------------------------------------
+//   the counterpart of "word_makelist" that writes the
+//   list into the caller-provided "buffer" of "capacity"
+//   elements (see "word_makelist" for the format), and
+//   returns "buffer", or NULL if it is too small.
+//
+// notes:
+// - the list needs ceil(word->length / bits_per_digit)
+//   elements, plus one for its header element.
+// - the digits are taken straight from the limbs of the
+//   amplitude of the word, which is formed on the stack,
+//   hence no memory is allocated.
+// --------------------------------------------------
+unsigned int* word_makelist_into(struct word_header* word, unsigned char bits_per_digit,
+								 unsigned int* buffer, unsigned int capacity) {
+	
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word passed to word_makelist_into.", NULL);
+	
+	WORD_VALIDATE(bits_per_digit > 0 && bits_per_digit <= 8 * sizeof(unsigned int), 
+				  "Invalid radix passed to word_makelist_into.", NULL);
+	
+	// compute the number of "bits_per_digit" blocks in
+	// the number, this is the number of digits to be
+	// returned in the list.
+	const unsigned int digit_count = 
+		(word->length + bits_per_digit - 1) / bits_per_digit;
+	
+	WORD_VALIDATE(NULL != buffer && capacity >= digit_count + 1, 
+				  "Insufficient space passed to word_makelist_into.", NULL);
 	
-	struct word_header* result = create_word_duplicate(word);
+	// store the number of digits in the additional
+	// header element.
+	buffer[0] = digit_count;
 	
-	// if the word was intended to convey a signed amount and
-	// had a sign bit of one (negative), then invert and add
-	// one to get the amplitude or the absolute value.
-	if (result->is_signed && 1 == BITS(result)[result->length - 1]) {
-		BITS(result)[result->length - 1] = 0;
-		
-		int sum = 1;
-		for (unsigned int i = 0; i < result->length; ++i) {
-
-			// remember that the most-significant bit of the
-			// result is the sign bit, and hence should not
-			// be involved in the inversion/addition process
-			// also remember that the word here is negative
-			// and hence should be padded with 1's
-			unsigned char source_bit = 1;
-			if (i < result->length - 1)
-				source_bit = BITS(result)[i];
-
-			// add the initial 1-valued sum to the inverted
-			// word bits
-			sum += (source_bit ? 0 : 1);
-			
-			BITS(result)[i] = sum & 1;
-			sum >>= 1;
-		}
-	}
+	// to make a digit list we need to work on the amplitude
+	// (the absolute value) stored in the number, which is
+	// formed on the stack.
+	uint64_t amplitude[LIMB_COUNT(word->length)];
+	word_magnitude(amplitude, word);
 	
-	return result;
+	// "i" is a digit counter varying from "0" (least-
+	// significant digit) to "digit_count - 1" (most-
+	// significant digit of "word").
+	// "j" is a pointer to the corresponding item of
+	// final list. To result in a big-endian ordering
+	// for the digit list, "j" is initialized with the
+	// address of the last list item and is decremented
+	// per iteration.
+	unsigned int* j = buffer + digit_count; // last digit
+	for (unsigned int i = 0; i < digit_count; ++i, --j)
+		*j = limbs_readdigit(amplitude, word->length, i, bits_per_digit);
+	
+	return buffer;
 }
 
 // --------------------------------------------------
@@ -354,39 +1489,28 @@ struct word_header* word_op_abs(struct word_header* word) {
 //   thing like: for (i = 1; i <= list[0]; ++i) where
 //   "i" can be served directly as an index.
 //   and hence srves the role of a header.
-// - this function is used inernally by the functions
-//   "word_makestring" and "word_makemathematicacode".
 //
 // warning:
 // - the list returned by this function call is 
 //   dynamically allocated using "malloc" and hence 
 //   should be freed manually to avoid memory leaks.
+//   "word_makelist_into" writes into a caller-provided
+//   buffer instead.
 // --------------------------------------------------
 unsigned int* word_makelist(struct word_header* word, unsigned char bits_per_digit) {
 	
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word passed to word_makelist.");
-		return NULL;
-	}
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word passed to word_makelist.", NULL);
 	
-	assert(bits_per_digit > 0);
-	if (bits_per_digit == 0) {
-		perror("Invalid radix passed to word_makelist.");
-		return NULL;
-	}
+	WORD_VALIDATE(bits_per_digit > 0, "Invalid radix passed to word_makelist.", NULL);
 	
-	// compute the number of "bits_per_digit" blocks in
-	// the number, this is the number of digits to be
-	// returned in the list.
-	const unsigned int digit_count = (unsigned int)
-		ceil((double) word->length / bits_per_digit);
 	// allocate an array of the type "unsigned int" to
 	// hold the digit values, with an additional header
 	// element dedicated to the number of digits in the
 	// list.
-	unsigned int* storage = 
-		malloc(sizeof(unsigned int) * (digit_count + 1));
+	const unsigned int capacity = 
+		(word->length + bits_per_digit - 1) / bits_per_digit + 1;
+	unsigned int* storage = malloc(sizeof(unsigned int) * capacity);
 	
 	assert(NULL != storage);
 	if (NULL == storage) {
@@ -394,97 +1518,153 @@ unsigned int* word_makelist(struct word_header* word, unsigned char bits_per_dig
 		return NULL;
 	}
 	
-	// store the number of digits in the additional
-	// header element.
-	storage[0] = digit_count;
-	
-	// to make a digit list we need to work on the amplitude
-	// (the absolute value) stored in the number.
-	struct word_header* amplitude = word_op_abs(word);
-	
-	// "i" is a digit counter varying from "0" (least-
-	// significant digit) to "digit_count - 1" (most-
-	// significant digit of "word").
-	// "j" is a pointer to the corresponding item of
-	// final list. To result in a big-endian ordering
-	// for the digit list, "j" is initialized with the
-	// address of the last list item and is decremented
-	// per iteration.
-	unsigned int* j = storage + digit_count; // last digit
-	for (unsigned int i = 0; i < digit_count; ++i, --j) {
-		
-		// here, we calculate the value of the i'th digit
-		unsigned int digit_value = BITS(amplitude)[i * bits_per_digit];
-		for (unsigned int k = 1; k < bits_per_digit; ++k) {
-			if ((i * bits_per_digit + k) >= amplitude->length)
-				break;
-			
-			digit_value += (BITS(amplitude)[i * bits_per_digit + k] << k);
-		}
-		
-		// assign the digit value to the corresponding
-		// item of the list.
-		*j = digit_value;
+	if (NULL == word_makelist_into(word, bits_per_digit, storage, capacity)) {
+		free(storage);
+		return NULL;
 	}
 	
-	word_deallocate(amplitude);
-	
 	// return a pointer to the list.
 	return storage;
 }
 
 // --------------------------------------------------
-// word_sign
+// word_makesignedlist_into
 // --------------------------------------------------
-char word_sign(struct word_header* word) {
-	return (!word->is_signed || 0 == BITS(word)[word->length - 1] ? ' ' : '-');
+//   the counterpart of "word_makesignedlist" that writes
+//   the list into the caller-provided "buffer" of 
+//   "capacity" elements, and returns "buffer", or NULL if
+//   it is too small.
+//
+// notes:
+// - the list needs as many elements as the one of 
+//   "word_makelist_into".
+// --------------------------------------------------
+int* word_makesignedlist_into(struct word_header* word, unsigned char bits_per_digit,
+							  int* buffer, unsigned int capacity) {
+	
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word passed to word_makesignedlist_into.", NULL);
+	
+	// a digit may take the value 2^bits_per_digit (see below).
+	WORD_VALIDATE(bits_per_digit > 0 && bits_per_digit <= 8 * sizeof(int) - 2, 
+				  "Invalid radix passed to word_makesignedlist_into.", NULL);
+	
+	const unsigned int digit_count = 
+		(word->length + bits_per_digit - 1) / bits_per_digit;
+	
+	WORD_VALIDATE(NULL != buffer && capacity >= digit_count + 1, 
+				  "Insufficient space passed to word_makesignedlist_into.", NULL);
+	
+	buffer[0] = (int) digit_count;
+	
+	// the digit "i" is read from the "bits_per_digit" bits of
+	// its own position plus the most-significant bit of the
+	// position below it ("incoming"), which is added to it,
+	// while its own most-significant bit is taken as a weight
+	// of -2^bits_per_digit and passed to the digit above.
+	// (bits above the word are copies of its sign, hence the
+	// most-significant digit of a signed word takes its sign
+	// bit with a negative weight, just like the word does)
+	int* j = buffer + digit_count; // last digit
+	for (unsigned int i = 0; i < digit_count; ++i, --j) {
+		const uint64_t field = 
+			word_readlimb(word, (int) (i * bits_per_digit) - 1);
+		
+		const int incoming = (int) (field & 1), 
+		          outgoing = (int) ((field >> bits_per_digit) & 1);
+		*j = (int) ((field >> 1) & ((1u << bits_per_digit) - 1)) + incoming;
+		
+		// the most-significant digit of an unsigned word keeps
+		// its most-significant bit, as there is no digit above
+		// it to pass it to, so it may reach 2^bits_per_digit.
+		if (!word->is_signed && i == digit_count - 1)
+			continue;
+		
+		*j -= outgoing << bits_per_digit;
+	}
+	
+	return buffer;
 }
 
 // --------------------------------------------------
-// word_makestring
+// word_makesignedlist
 // --------------------------------------------------
-//   returns a textual representation of the word bits
-//   expressed to the base 2, 4, 8 or 16.
+//   returns a list of signed digits to the radix "2^bits_
+//   per_digit", with the same format as the one returned
+//   by "word_makelist", where the digits are recoded (in
+//   the style of Booth) so that they add up to the value
+//   of the word (sign included). all of them lie within the
+//   set {-2^(bits_per_digit - 1), ..., +2^(bits_per_digit
+//   - 1)}, but the most-significant digit of an unsigned
+//   word.
+//
+// notes:
+// - the most-significant digit of an unsigned word lies
+//   within {0, ..., 2^bits_per_digit} instead, as it keeps
+//   the bit that would otherwise be carried out into an
+//   extra digit, so that the list has the same number of
+//   digits as the one of "word_makelist".
 //
 // warning:
-// - the string returned by this function call is 
+// - the list returned by this function call is 
 //   dynamically allocated using "malloc" and hence 
 //   should be freed manually to avoid memory leaks.
 // --------------------------------------------------
-char* word_makestring(struct word_header* word, unsigned short base) {
+int* word_makesignedlist(struct word_header* word, unsigned char bits_per_digit) {
+	
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word passed to word_makesignedlist.", NULL);
+	
+	WORD_VALIDATE(bits_per_digit > 0, "Invalid radix passed to word_makesignedlist.", NULL);
+	
+	const unsigned int capacity = 
+		(word->length + bits_per_digit - 1) / bits_per_digit + 1;
+	int* storage = malloc(sizeof(int) * capacity);
+	
+	assert(NULL != storage);
+	if (NULL == storage) {
+		perror("Couldn't allocate memory for word_makesignedlist.");
+		return NULL;
+	}
 	
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word passed to word_makestring.");
+	if (NULL == word_makesignedlist_into(word, bits_per_digit, storage, capacity)) {
+		free(storage);
 		return NULL;
 	}
 	
-	assert(2 == base || 4 == base || 8 == base || 
-		   16 == base || 32 == base || 64 == base || 
-		   128 == base || 256 == base || 512 == base);
+	return storage;
+}
+
+// --------------------------------------------------
+// word_sign
+// --------------------------------------------------
+char word_sign(struct word_header* word) {
+	return (!word->is_signed || 0 == word_getbit(word, word->length - 1) ? ' ' : '-');
+}
+
+// --------------------------------------------------
+// word_makestring_capacity
+// --------------------------------------------------
+//   returns the number of bytes (including the null 
+//   character) needed by "word_makestring_into" for a
+//   word of "length" bits to the base "base", or zero
+//   if the base isn't supported.
+// --------------------------------------------------
+size_t word_makestring_capacity(unsigned short length, unsigned short base) {
+	
+	// compute the number of bits per digit.
+	unsigned char bits_per_digit = 0;
 	switch (base) {
 		case 2: case 4: case 8: 
 		case 16: case 32: case 64: 
 		case 128: case 256: case 512:
+			while (base >>= 1)
+				++bits_per_digit;
 			break;
 		default:
-			perror("Invalid base passed to word_makestring.");
-			return NULL;
-	}
-	
-	// compute the correct value for bits_per_digit of
-	// word_makelist.
-	unsigned char bits_per_digit = 0;
-	while (base >>= 1) {
-		++bits_per_digit;
+			return 0;
 	}
 	
-	// get a list of digits.
-	unsigned int* digits = word_makelist(word, bits_per_digit);
-	
-	if (NULL == digits)
-		return NULL;
-	
 	// look up the number of characters per digit, 
 	// depending on the radix.
 	unsigned char characters_per_digit = 1;
@@ -494,54 +1674,122 @@ char* word_makestring(struct word_header* word, unsigned short base) {
 		characters_per_digit = 3;
 	}
 	
-	// use this number to allocate memory for the
-	// resulting string, note that an additional
-	// byte is needed for the null character.
-	const unsigned int digit_count = digits[0];
+	// note that an additional byte is needed for the
+	// null character.
+	const size_t digit_count = (length + bits_per_digit - 1) / bits_per_digit;
+	return digit_count * characters_per_digit + 1;
+}
 
-	char* storage = malloc(digit_count * characters_per_digit + 1);
+// --------------------------------------------------
+// word_makestring_into
+// --------------------------------------------------
+//   the counterpart of "word_makestring" that writes 
+//   the string into the caller-provided "buffer" of 
+//   "capacity" bytes (see "word_makestring_capacity"),
+//   and returns "buffer", or NULL if it is too small.
+//
+// notes:
+// - the digits are taken straight from the limbs of the
+//   amplitude of the word, which is formed on the stack,
+//   hence no memory is allocated.
+// --------------------------------------------------
+char* word_makestring_into(struct word_header* word, unsigned short base,
+						   char* buffer, size_t capacity) {
 	
-	assert(NULL != storage);
-	if (NULL == storage) {
-		perror("Couldn't allocate memory for word_makestring.");
-		// so that a case of error will not result
-		// in a memory leak.
-		free(digits);
-		return NULL;
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word passed to word_makestring_into.", NULL);
+	
+	const size_t required_capacity = word_makestring_capacity(word->length, base);
+	
+	WORD_VALIDATE(0 != required_capacity, "Invalid base passed to word_makestring_into.", NULL);
+	
+	WORD_VALIDATE(NULL != buffer && capacity >= required_capacity, 
+				  "Insufficient space passed to word_makestring_into.", NULL);
+	
+	// compute the correct number of bits per digit.
+	unsigned char bits_per_digit = 0;
+	while (base >>= 1) {
+		++bits_per_digit;
 	}
 	
+	const unsigned int digit_count = 
+		(word->length + bits_per_digit - 1) / bits_per_digit;
+	const unsigned int characters_per_digit = 
+		(unsigned int) (required_capacity - 1) / digit_count;
+	
+	// the amplitude (the absolute value) of the word, out
+	// of which the digits are read.
+	uint64_t amplitude[LIMB_COUNT(word->length)];
+	word_magnitude(amplitude, word);
+	
 	// terminate the resulting string.
-	storage[digit_count] = '\0';
+	buffer[digit_count] = '\0';
 	
 	// produce the string by translating digit values
 	// to either single digit characters (for radices
 	// less or equal to 16) or decimal values (higher
-	// radices).
+	// radices), starting from the most-significant one.
 	for (unsigned int i = 0; i < digit_count; ++i) {
+		const unsigned int digit = 
+			limbs_readdigit(amplitude, word->length, digit_count - 1 - i, bits_per_digit);
+		
 		if (bits_per_digit <= 4) {
-			if ((digits+1)[i] < 10)
-				storage[i] = (char) '0' + (digits+1)[i];
-			else storage[i] = (char) 'A' + ((digits+1)[i] - 10);
+			if (digit < 10)
+				buffer[i] = (char) '0' + digit;
+			else buffer[i] = (char) 'A' + (digit - 10);
 			
 		} else {
 			char format_string[5];
 			// remember that characters_per_digit includes the one character
 			// needed for separating the digits '|'
 			snprintf(format_string, 5, "%%0%du", characters_per_digit - 1);
-			sprintf(storage + i * characters_per_digit, format_string, (digits+1)[i]);
-			storage[(i + 1) * characters_per_digit - 1] = '|';
+			sprintf(buffer + i * characters_per_digit, format_string, digit);
+			buffer[(i + 1) * characters_per_digit - 1] = '|';
 		}
 	}
 	
 	// all non-single-character-digit cases {base larger than 16}
 	if (bits_per_digit > 4) { 
-		storage[digit_count * characters_per_digit - 1] = '\0';
+		buffer[digit_count * characters_per_digit - 1] = '\0';
+	}
+	
+	return buffer;
+}
+
+// --------------------------------------------------
+// word_makestring
+// --------------------------------------------------
+//   returns a textual representation of the word bits
+//   expressed to the base 2, 4, 8 or 16.
+//
+// warning:
+// - the string returned by this function call is 
+//   dynamically allocated using "malloc" and hence 
+//   should be freed manually to avoid memory leaks.
+//   "word_makestring_into" writes into a caller-provided
+//   buffer instead.
+// --------------------------------------------------
+char* word_makestring(struct word_header* word, unsigned short base) {
+	
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word passed to word_makestring.", NULL);
+	
+	const size_t capacity = word_makestring_capacity(word->length, base);
+	
+	WORD_VALIDATE(0 != capacity, "Invalid base passed to word_makestring.", NULL);
+	
+	char* storage = malloc(capacity);
+	
+	assert(NULL != storage);
+	if (NULL == storage) {
+		perror("Couldn't allocate memory for word_makestring.");
+		return NULL;
 	}
 	
-	// now that the digit list has been fully translated
-	// into a string, we can free the space associated
-	// with the list.
-	free(digits);
+	if (NULL == word_makestring_into(word, base, storage, capacity)) {
+		free(storage);
+		return NULL;
+	}
 	
 	return storage;
 }
@@ -565,52 +1813,53 @@ char* word_cleanstring(char* string) {
 }
 
 // --------------------------------------------------
-// word_makemathematicacode
+// word_makemathematicacode_capacity
 // --------------------------------------------------
-//   returns the code line needed to evaluate the de-
-//   cimal equiavlent of the word bits through mathe-
-//   matica, which will allow us to verify the comp-
-//   utations performed by this code.
-//
-// warning:
-// - the string returned by this function call is 
-//   dynamically allocated using "malloc" and hence 
-//   should be freed manually to avoid memory leaks.
+//   returns the number of bytes (including the null 
+//   character) needed by "word_makemathematicacode_into"
+//   for a word of "length" bits.
 // --------------------------------------------------
-char* word_makemathematicacode(struct word_header* word) {
+size_t word_makemathematicacode_capacity(unsigned short length) {
 	
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word passed to word_makemathematicacode.");
-		return NULL;
-	}
+	// the code line is equal to "FromDigits[{D1, D2, ...}, 512]",
+	// with up to 3 characters per digit to the base 512.
+	return 20 + (((unsigned int) length + 8) / 9) * 5 - 1;
+}
+
+// --------------------------------------------------
+// word_makemathematicacode_into
+// --------------------------------------------------
+//   the counterpart of "word_makemathematicacode" that
+//   writes the code line into the caller-provided 
+//   "buffer" of "capacity" bytes (see "word_makemathe-
+//   maticacode_capacity"), and returns "buffer", or 
+//   NULL if it is too small.
+// --------------------------------------------------
+char* word_makemathematicacode_into(struct word_header* word, 
+									char* buffer, size_t capacity) {
 	
-	// retrieve the number as a list of digits to the base 512.
-	unsigned int* digits_to_the_base_512 = word_makelist(word, 9);
-	if (NULL == digits_to_the_base_512) {
-		return NULL;
-	}
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word passed to word_makemathematicacode_into.", NULL);
 	
-	// allocate a number of bytes sufficient for the mathematica
-	// code line which is equal to "FromDigits[{D1, D2, ...}, 512]"
-	const size_t bytes_count = 20 + (digits_to_the_base_512[0] * 5) - 1;
+	const size_t bytes_count = word_makemathematicacode_capacity(word->length);
 	
-	char* storage = malloc(bytes_count);
-	assert(NULL != storage);
-	if (NULL == storage) {
-		perror("Couldn;t allocate memory for word_makemathematicacode.");
-		free(digits_to_the_base_512);
-		return NULL;
-	}
+	WORD_VALIDATE(NULL != buffer && capacity >= bytes_count, 
+				  "Insufficient space passed to word_makemathematicacode_into.", NULL);
 	
-	char* cursor = storage;
-	memset((void*) storage, 0, bytes_count);
+	// the digits to the base 512 are read straight from the
+	// amplitude of the word.
+	const unsigned int digit_count = (word->length + 8) / 9;
+	uint64_t amplitude[LIMB_COUNT(word->length)];
+	word_magnitude(amplitude, word);
+	
+	char* cursor = buffer;
+	memset((void*) buffer, 0, bytes_count);
 	
 	// construct the code line while keeping track of remaining
 	// bytes in the storage buffer to avoid write violations.
 	int remaining_size = bytes_count;
 	
-	if (word->is_signed && 1 == BITS(word)[word->length - 1]) {
+	if (0 != word_signfill(word)) {
 		*(cursor++) = '-';
 		--remaining_size;
 	}
@@ -623,15 +1872,16 @@ char* word_makemathematicacode(struct word_header* word) {
 	remaining_size -= sizeof("FromDigits[{") - 1;
 	cursor += sizeof("FromDigits[{") - 1;
 	
-	for (unsigned int i = 0; i < digits_to_the_base_512[0]; ++i) {
-		snprintf(cursor, remaining_size, "%d", (digits_to_the_base_512+1)[i]);
+	for (unsigned int i = 0; i < digit_count; ++i) {
+		snprintf(cursor, remaining_size, "%d", 
+				 limbs_readdigit(amplitude, word->length, digit_count - 1 - i, 9));
 		
 		while ('\0' != *cursor) {
 			++cursor;
 			--remaining_size;
 		}
 		
-		if (i != digits_to_the_base_512[0] - 1) {
+		if (i != digit_count - 1) {
 			strncpy(cursor, ", ", remaining_size - 1);
 			
 			cursor += sizeof(", ") - 1;
@@ -639,18 +1889,47 @@ char* word_makemathematicacode(struct word_header* word) {
 		}
 	}
 	
-	// since all the digits were consumed, we can now release
-	// the space associated with the digit list.
-	free(digits_to_the_base_512);
-	
 	strncpy(cursor, "}, 512]", remaining_size - 1);
 	
 	cursor += sizeof("}, 512]") - 1;
 	remaining_size -= sizeof("}, 512]") - 1;
 	
-	assert(remaining_size >= 1 && '\0' == *cursor);
-	if (remaining_size < 1 || '\0' != *cursor) {
-		perror("Insufficient space for mathematica code, revision of code is needed.");
+	WORD_VALIDATE(remaining_size >= 1 && '\0' == *cursor, 
+				  "Insufficient space for mathematica code, revision of code is needed.", NULL);
+	
+	return buffer;
+}
+
+// --------------------------------------------------
+// word_makemathematicacode
+// --------------------------------------------------
+//   returns the code line needed to evaluate the de-
+//   cimal equiavlent of the word bits through mathe-
+//   matica, which will allow us to verify the comp-
+//   utations performed by this code.
+//
+// warning:
+// - the string returned by this function call is 
+//   dynamically allocated using "malloc" and hence 
+//   should be freed manually to avoid memory leaks.
+//   "word_makemathematicacode_into" writes into a 
+//   caller-provided buffer instead.
+// --------------------------------------------------
+char* word_makemathematicacode(struct word_header* word) {
+	
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word passed to word_makemathematicacode.", NULL);
+	
+	const size_t bytes_count = word_makemathematicacode_capacity(word->length);
+	
+	char* storage = malloc(bytes_count);
+	assert(NULL != storage);
+	if (NULL == storage) {
+		perror("Couldn;t allocate memory for word_makemathematicacode.");
+		return NULL;
+	}
+	
+	if (NULL == word_makemathematicacode_into(word, storage, bytes_count)) {
 		free(storage);
 		return NULL;
 	}
@@ -661,39 +1940,45 @@ char* word_makemathematicacode(struct word_header* word) {
 // --------------------------------------------------
 // word_op_compare
 // --------------------------------------------------
+//   returns +1, 0 or -1 depending on whether the value of
+//   "word1" is greater than, equal to or less than that
+//   of "word2", each being interpreted according to its
+//   own type.
+//
+// notes:
+// - words of opposite signs are told apart by their sign
+//   alone, otherwise the sign-extended limbs are compared
+//   from the most-significant one down, and the first
+//   differing bit (found with a count of leading zeros)
+//   decides the result.
+// --------------------------------------------------
 char word_op_compare(struct word_header* word1, struct word_header* word2) {
 	
-	assert(NULL != word1 && word1->length > 0 && NULL != word2 && word2->length > 0);
-	if (NULL == word1 || 0 == word1->length || NULL == word2 || 0 == word2->length) {
-		perror("Invalid word was passed to word_op_compare.");
-		return 2;
-	}
+	WORD_VALIDATE(NULL != word1 && word1->length > 0 && NULL != word2 && word2->length > 0, 
+				  "Invalid word was passed to word_op_compare.", 2);
 	
 	// in the case of signed numbers, we only need to check any mismatch in sign
 	// if the sign of both numbers is the same, then no need to change the code
-	unsigned char sign1 = 0, sign2 = 0;
-	if (!word1->is_signed || 0 == BITS(word1)[word1->length - 1])
-		sign1 = 1;
-	if (!word2->is_signed || 0 == BITS(word2)[word2->length - 1])
-		sign2 = 1;
-	
-	if (sign1 > sign2) 
-		return +1;
-	else if (sign1 < sign2)
-		return -1;
+	const uint64_t fill1 = word_signfill(word1), fill2 = word_signfill(word2);
+	if (0 != (fill1 ^ fill2))
+		return (0 != fill1 ? -1 : +1);
 	
+	// with equal signs, the sign-extended limbs compare just
+	// like unsigned integers.
+	const unsigned int count1 = LIMB_COUNT(word1->length), 
+	                   count2 = LIMB_COUNT(word2->length);
+	const unsigned int count = (count1 > count2 ? count1 : count2);
 	
-	const unsigned int size = (word1->length > word2->length ? 
-							   word1->length : word2->length);
-	
-	for (int i = size - 1; i >= 0; --i) {
+	for (int i = count - 1; i >= 0; --i) {
 		
-		unsigned char source_bit1 = (sign1 ? 0 : 1), source_bit2 = (sign2 ? 0 : 1);
-		if (i < word1->length) source_bit1 = BITS(word1)[i];
-		if (i < word2->length) source_bit2 = BITS(word2)[i];
+		const uint64_t limb1 = word_readlimb(word1, i * LIMB_BITS),
+		               limb2 = word_readlimb(word2, i * LIMB_BITS);
+		const uint64_t difference = limb1 ^ limb2;
 		
-		if (source_bit1 > source_bit2) return +1;
-		if (source_bit1 < source_bit2) return -1;
+		if (0 != difference) {
+			const unsigned int bit = LIMB_BITS - 1 - __builtin_clzll(difference);
+			return (((limb1 >> bit) & 1) ? +1 : -1);
+		}
 	}
 	
 	return 0;
@@ -702,43 +1987,37 @@ char word_op_compare(struct word_header* word1, struct word_header* word2) {
 // --------------------------------------------------
 // word_op_compare_constant
 // --------------------------------------------------
+//   the counterpart of "word_op_compare" that compares
+//   "word" with the (signed) integer "constant".
+//
+// notes:
+// - a comparison with zero only needs to know whether
+//   any bit of the word is set, and its sign.
+// --------------------------------------------------
 char word_op_compare_constant(struct word_header* word, int constant) {
 	
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word was passed to word_op_compare_constant.");
-		return 2;
-	}
-	
-	// in the case of signed numbers, we only need to check any mismatch in sign
-	// if the sign of both numbers is the same, then no need to change the code
-	unsigned char sign1 = 0, sign2 = 0;
-	if (!word->is_signed || 0 == BITS(word)[word->length - 1])
-		sign1 = 1;
-	if (constant >= 0)
-		sign2 = 1;
-	
-	if (sign1 > sign2) 
-		return +1;
-	else if (sign1 < sign2)
-		return -1;
-	
-	const unsigned int size = (word->length > 8 * sizeof(unsigned int) ? 
-							   word->length : 8 * sizeof(unsigned int));
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word was passed to word_op_compare_constant.", 2);
 	
-	for (int i = size - 1; i >= 0; --i) {
+	if (0 == constant) {
+		uint64_t any_bit = 0;
+		for (unsigned int i = 0; i < (unsigned int) LIMB_COUNT(word->length); ++i)
+			any_bit |= LIMBS(word)[i];
 		
-		unsigned char source_bit1 = (sign1 ? 0 : 1), source_bit2 = (sign2 ? 0 : 1);
-		if (i < word->length) 
-			source_bit1 = BITS(word)[i];
-		if (i < 8 * sizeof(unsigned int)) 
-			source_bit2 = (unsigned char) ((unsigned int) 1 & (constant >> i));
-		
-		if (source_bit1 > source_bit2) return +1;
-		if (source_bit1 < source_bit2) return -1;
+		if (0 == any_bit)
+			return 0;
+		return (0 != word_signfill(word) ? -1 : +1);
 	}
 	
-	return 0;
+	// otherwise, the constant is held in a small word of its
+	// own.
+	struct small_word constant_storage;
+	struct word_header* constant_word = 
+		create_small_word(&constant_storage, 8 * sizeof(int));
+	constant_word->is_signed = 1;
+	LIMBS(constant_word)[0] = (unsigned int) constant;
+	
+	return word_op_compare(word, constant_word);
 }
 
 // --------------------------------------------------
@@ -746,63 +2025,127 @@ char word_op_compare_constant(struct word_header* word, int constant) {
 // --------------------------------------------------
 void word_op_rightshift(struct word_header* word, unsigned short bitcount) {
 	
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word was passed to word_op_rightshift.");
-		return ;
-	}
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word was passed to word_op_rightshift.");
 	
-	// extension bit is determined by the sign variable which is
+	// extension bits are determined by the sign variable which is
 	// equal to zero in the case of an unsigned word and equal
 	// to the sign bit in the case of a signed word.
 	// in effect, the choice between a logical and an arithmetic
 	// right shift is determined by whether the shifted word is
 	// of a signed or an unsigned type.
-	unsigned char sign = 0;
-	if (word->is_signed)
-		sign = BITS(word)[word->length - 1];
-	
-	for (unsigned int i = 0; i < word->length; ++i) {
+	const uint64_t sign = word_signfill(word);
+	
+	const unsigned int length = word->length, 
+	                   limb_count = LIMB_COUNT(length);
+	const unsigned int shifted_out = (bitcount < length ? bitcount : length);
+	
+	// an underflow occurs if any of the bits shifted out is a one,
+	// which is checked a whole limb at a time.
+	if (WORD_CHECKED)
+		for (unsigned int i = 0; i < LIMB_COUNT(shifted_out); ++i)
+			if (0 != (LIMBS(word)[i] & limb_rangemask(i, 0, shifted_out)))
+				word->underflow = 1;
+	
+	if (bitcount >= length) {
+		for (unsigned int i = 0; i < limb_count; ++i)
+			LIMBS(word)[i] = sign;
 		
-		unsigned int source_bit = sign;
-		if ((i + bitcount) < word->length)
-			source_bit = BITS(word)[i + bitcount];
-		
-		if (i < bitcount && BITS(word)[i] != 0)
-			word->underflow = 1;
-		
-		BITS(word)[i] = source_bit;
+		word_clearpadding(word);
+		return ;
+	}
+	
+	// move whole limbs first, then shift the bits across the
+	// limb boundaries (a funnel shift).
+	const unsigned int limb_shift = bitcount / LIMB_BITS, 
+	                   bit_shift = bitcount % LIMB_BITS;
+	
+	if (0 != limb_shift) {
+		memmove(LIMBS(word), LIMBS(word) + limb_shift, 
+				(limb_count - limb_shift) * sizeof(uint64_t));
+		memset(LIMBS(word) + (limb_count - limb_shift), 0, 
+			   limb_shift * sizeof(uint64_t));
+	}
+	
+	if (0 != bit_shift) {
+		for (unsigned int i = 0; i < limb_count; ++i) {
+			LIMBS(word)[i] >>= bit_shift;
+			if (i + 1 < limb_count)
+				LIMBS(word)[i] |= LIMBS(word)[i + 1] << (LIMB_BITS - bit_shift);
+		}
+	}
+	
+	// the vacated most-significant bits receive the extension bit.
+	if (0 != sign) {
+		for (unsigned int i = (length - bitcount) / LIMB_BITS; i < limb_count; ++i)
+			LIMBS(word)[i] |= limb_rangemask(i, length - bitcount, length);
 	}
 }
 
 // --------------------------------------------------
 // word_op_leftshift
 // --------------------------------------------------
+//   shifts the word to the left, while keeping the sign
+//   bit of a signed word in place.
+//
+// notes:
+// - an overflow occurs if any of the bits shifted out
+//   differs from the sign (zero, for an unsigned word).
+// --------------------------------------------------
 void word_op_leftshift(struct word_header* word, unsigned short bitcount) {
 	
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word was passed to word_op_leftshift.");
-		return ;
-	}
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word was passed to word_op_leftshift.");
 	
-	unsigned char sign = 0, sign_bit = 0;
-	if (word->is_signed) {
+	unsigned char sign_bit = 0;
+	const uint64_t sign = word_signfill(word);
+	if (word->is_signed)
 		sign_bit = 1;
-		sign = BITS(word)[word->length - 1];
-	}
 	
-	for (int i = word->length - 1 - sign_bit; i >= 0; --i) {
+	// "width" is the number of bits taking part in the shift,
+	// which excludes the sign bit of a signed word.
+	const unsigned int length = word->length, 
+	                   limb_count = LIMB_COUNT(length),
+	                   width = length - sign_bit;
+	const unsigned int shifted_out = (bitcount < width ? bitcount : width);
+	
+	// check the bits shifted out against the sign, a whole limb
+	// at a time.
+	for (unsigned int i = (width - shifted_out) / LIMB_BITS; i < LIMB_COUNT(width); ++i)
+		if (0 != ((LIMBS(word)[i] ^ sign) & limb_rangemask(i, width - shifted_out, width)))
+			word->overflow = 1;
+	
+	// take the sign bit out of the way, it is restored at the end.
+	if (sign_bit)
+		word_setbit(word, length - 1, 0);
+	
+	if (bitcount >= width) {
+		memset(LIMBS(word), 0, limb_count * sizeof(uint64_t));
+	} else {
+		const unsigned int limb_shift = bitcount / LIMB_BITS, 
+		                   bit_shift = bitcount % LIMB_BITS;
 		
-		unsigned int source_bit = 0;
-		if ((i - bitcount) >= 0)
-			source_bit = BITS(word)[i - bitcount];
+		if (0 != limb_shift) {
+			memmove(LIMBS(word) + limb_shift, LIMBS(word), 
+					(limb_count - limb_shift) * sizeof(uint64_t));
+			memset(LIMBS(word), 0, limb_shift * sizeof(uint64_t));
+		}
 		
-		if (((word->length - 1 - sign_bit) - i) < bitcount && BITS(word)[i] != sign)
-			word->overflow = 1;
+		if (0 != bit_shift) {
+			for (int i = limb_count - 1; i >= 0; --i) {
+				LIMBS(word)[i] <<= bit_shift;
+				if (i > 0)
+					LIMBS(word)[i] |= LIMBS(word)[i - 1] >> (LIMB_BITS - bit_shift);
+			}
+		}
 		
-		BITS(word)[i] = source_bit;
+		// drop the bits shifted beyond the width.
+		for (unsigned int i = width / LIMB_BITS; i < limb_count; ++i)
+			LIMBS(word)[i] &= ~limb_rangemask(i, width, limb_count * LIMB_BITS);
 	}
+	
+	if (sign_bit)
+		word_setbit(word, length - 1, sign & 1);
 }
 
 // --------------------------------------------------
@@ -810,285 +2153,882 @@ void word_op_leftshift(struct word_header* word, unsigned short bitcount) {
 // --------------------------------------------------
 void word_op_bitinvert(struct word_header* word) {
 	
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word was passed to word_op_bitinvert.");
-		return ;
-	}
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word was passed to word_op_bitinvert.");
 	
 	// bitinvert is unaffected by whether the word is signed
 	// or not, in either case it simply inverts all the bits
 	
-	for (unsigned int i = 0; i < word->length; ++i)
-		BITS(word)[i] = (BITS(word)[i] ? 0 : 1);
+	for (unsigned int i = 0; i < (unsigned int) LIMB_COUNT(word->length); ++i)
+		LIMBS(word)[i] = ~LIMBS(word)[i];
+	
+	// the padding bits were inverted along with the rest.
+	word_clearpadding(word);
 }
 
 // --------------------------------------------------
 // word_approximatevalue
 // --------------------------------------------------
+//   returns the value of "word" as a double, adding up
+//   the limbs of its magnitude (see "word_magnitude")
+//   from the most-significant one, so that the sign of a
+//   negative word doesn't cancel out its leading bits.
+// --------------------------------------------------
 double word_approximatevalue(struct word_header* word) {
 
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word was passed to word_approximatevalue.");
-		return 0.0;
-	}
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word was passed to word_approximatevalue.", 0.0);
+	
+	uint64_t magnitude[LIMB_COUNT(word->length)];
+	const unsigned char negative = word_magnitude(magnitude, word);
 	
 	double approximation = 0.0;
-	for (int i = word->length - 1, first_iteration = 1; i >= 0; --i, first_iteration = 0)
+	for (int i = LIMB_COUNT(word->length) - 1; i >= 0; --i)
 		approximation += 
-			(first_iteration && word->is_signed && BITS(word)[i] != 0 ? -1.0 : 1.0) * 
-			(BITS(word)[i] ? (double) ldexp(1.0, i) /* 2 to the power i */ : 0.0);
+			ldexp((double) magnitude[i], i * LIMB_BITS /* 2 to the power of the limb position */);
 	
-	return approximation;
+	return (negative ? -approximation : approximation);
 }
 
 // --------------------------------------------------
 // word_op_extract
 // --------------------------------------------------
+//   copies the bits of "word" starting at the bit 
+//   "position" into "sample", a limb at a time (zeros
+//   below the word, and its sign above it, see "word_
+//   readlimb").
+// --------------------------------------------------
 void word_op_extract(struct word_header* word, 
 					 struct word_header* sample,
 					 short position) {
 	
-	assert(NULL != word && word->length > 0 && NULL != sample && sample->length > 0);
-	if (NULL == word || 0 == word->length || NULL == sample || 0 == sample->length) {
-		perror("Invalid word was passed to word_op_extract.");
-		return ;
-	}
+	WORD_VALIDATE(NULL != word && word->length > 0 && NULL != sample && sample->length > 0, 
+				  "Invalid word was passed to word_op_extract.");
 	
-	for (int i = position, j = 0; j < sample->length; ++i, ++j) {
+	for (int k = 0; k < LIMB_COUNT(sample->length); ++k)
+		LIMBS(sample)[k] = word_readlimb(word, position + k * LIMB_BITS);
+	
+	word_clearpadding(sample);
+	
+	return ;
+}
 
-		unsigned char sign = 0, source = 0;
-		if (word->is_signed && BITS(word)[word->length - 1]) sign = 1;
-		
-		if (i >= 0 && i < word->length)
-			source = BITS(word)[i];
-		else if (i >= word->length)
-			source = sign;
-		
-		BITS(sample)[j] = source;
+// --------------------------------------------------
+// word_extract_bits
+// --------------------------------------------------
+//   returns the "count" bits of "word" starting at the
+//   bit "position" as an integer, sign-extended from the
+//   most-significant of these bits if "sign_extend" is
+//   set, zero-extended otherwise.
+//
+// notes:
+// - this is the counterpart of "word_op_extract" when
+//   the sample is small enough (up to 64 bits) to be 
+//   held in an integer, the bits are read the same way
+//   (zeros below the word, and its sign above it) with
+//   no more than two limb reads.
+// --------------------------------------------------
+int64_t word_extract_bits(struct word_header* word, int position, 
+						  unsigned int count, unsigned char sign_extend) {
+	
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word was passed to word_extract_bits.", 0);
+	WORD_VALIDATE(count > 0 && count <= LIMB_BITS, 
+				  "Invalid bit count was passed to word_extract_bits.", 0);
+	
+	uint64_t field = word_readlimb(word, position);
+	
+	if (count < LIMB_BITS) {
+		field &= ((uint64_t) 1 << count) - 1;
+		if (sign_extend && ((field >> (count - 1)) & 1))
+			field |= ~(uint64_t) 0 << count;
 	}
 	
-	return ;
+	return (int64_t) field;
 }
 
 // --------------------------------------------------
 // word_op_load
 // --------------------------------------------------
+//   overwrites the bits [position, position + width of
+//   "value") of "word" with the bits of "value", while
+//   the other bits of "word" are left untouched.
+//
+// notes:
+// - the bits are moved a whole limb at a time, every
+//   limb of "word" covered by the range is merged with
+//   the matching 64 bits of "value" under a range mask.
+// - the bits of "value" that fall beyond the width of
+//   "word" should be copies of its sign, the overflow
+//   flag is set otherwise (once the bits within the
+//   width have been loaded).
+// --------------------------------------------------
 void word_op_load(struct word_header* word, struct word_header* value,
 				  unsigned short position) {
 	
-	assert(NULL != word && word->length > 0 && NULL != value && value->length > 0);
-	if (NULL == word || 0 == word->length || NULL == value || 0 == value->length) {
-		perror("Invalid word was passed to word_op_load.");
-		return ;
-	}
+	WORD_VALIDATE(NULL != word && word->length > 0 && NULL != value && value->length > 0, 
+				  "Invalid word was passed to word_op_load.");
 	
 	unsigned char sign1 = 0, sign2 = 0;
-	if (word->is_signed  && BITS(word) [word->length  - 1]) sign1 = 1;
-	if (value->is_signed && BITS(value)[value->length - 1]) sign2 = 1;	
+	if (word->is_signed  && word_getbit(word,  word->length  - 1)) sign1 = 1;
+	if (value->is_signed && word_getbit(value, value->length - 1)) sign2 = 1;	
 	
-	assert(sign1 == sign2);
-	if (sign1 != sign2) {
-		perror("loaded_word differs in sign from the base word (word_op_load).");
-		return ;
-	}
+	WORD_VALIDATE(sign1 == sign2, 
+				  "loaded_word differs in sign from the base word (word_op_load).");
+	
+	const unsigned int end = position + value->length,
+	                   loaded_end = (end < word->length ? end : word->length),
+	                   loaded = (loaded_end > position ? loaded_end - position : 0);
 	
-	for (unsigned int i = position, j = 0; i < position + value->length; ++i, ++j) {
+	if (0 != loaded) {
+		uint64_t* limbs = LIMBS(word);
 		
-		if (i >= word->length && BITS(value)[j] != sign1) {
-			word->overflow = 1;
-			return ;
+		for (unsigned int i = position / LIMB_BITS; i <= (loaded_end - 1) / LIMB_BITS; ++i) {
+			const uint64_t mask = limb_rangemask(i, position, loaded_end);
+			limbs[i] = (limbs[i] & ~mask) | 
+				(word_readlimb(value, (int) (i * LIMB_BITS) - position) & mask);
 		}
+	}
+	
+	if (WORD_CHECKED && end > word->length) {
+		// the bits of "value" which lie beyond the width
+		// of "word" are compared a limb at a time.
+		const uint64_t fill = (sign1 ? ~(uint64_t) 0 : 0);
 		
-		if (i < word->length)
-			BITS(word)[i] = BITS(value)[j];
+		for (unsigned int j = loaded; j < value->length; j += LIMB_BITS) {
+			const uint64_t mask = limb_rangemask(0, 0, value->length - j);
+			
+			if (0 != ((word_readlimb(value, (int) j) ^ fill) & mask)) {
+				word->overflow = 1;
+				return ;
+			}
+		}
 	}
 }
 
 // --------------------------------------------------
 // word_op_load_constant
 // --------------------------------------------------
+//   overwrites the bits [position, position + bitcount)
+//   of "word" with the low "bitcount" bits of "value",
+//   the same way as "word_op_load" does.
+// --------------------------------------------------
 void word_op_load_constant(struct word_header* word, unsigned int value,
 						   unsigned short position, unsigned short bitcount) {
 	
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word was passed to word_op_load_constant.");
-		return ;
-	}
-	assert(bitcount <= 8 * sizeof(unsigned int));
-	if (bitcount > 8 * sizeof(unsigned int)) {
-		perror("Invalid bitcount was passed to word_op_load_constant.");
-		return ;
-	}
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word was passed to word_op_load_constant.");
+	WORD_VALIDATE(bitcount <= 8 * sizeof(unsigned int), 
+				  "Invalid bitcount was passed to word_op_load_constant.");
 	
 	unsigned char sign = 0;
 	if (word->is_signed && ((signed int) value) < 0)
 		sign = 1;
 	
-	for (unsigned int i = position; i < position + bitcount; ++i) {
+	const uint64_t field = (uint64_t) value & limb_rangemask(0, 0, bitcount);
+	const unsigned int end = position + bitcount,
+	                   loaded_end = (end < word->length ? end : word->length),
+	                   loaded = (loaded_end > position ? loaded_end - position : 0);
+	
+	if (0 != loaded) {
+		uint64_t* limbs = LIMBS(word);
 		
-		if (i >= word->length && (1 & value) != sign) {
-			word->overflow = 1;
-			return ;
+		// the field spans two limbs at most.
+		for (unsigned int i = position / LIMB_BITS; i <= (loaded_end - 1) / LIMB_BITS; ++i) {
+			const uint64_t mask = limb_rangemask(i, position, loaded_end);
+			const uint64_t bits = (i * LIMB_BITS >= position ? 
+								   field >> (i * LIMB_BITS - position) : 
+								   field << (position - i * LIMB_BITS));
+			limbs[i] = (limbs[i] & ~mask) | (bits & mask);
 		}
+	}
+	
+	if (WORD_CHECKED && end > word->length) {
+		const uint64_t mask = limb_rangemask(0, loaded, bitcount);
 		
-		if (i < word->length)
-			BITS(word)[i] = 1 & value;
-		
-		value >>= 1;
+		if (0 != ((field ^ (sign ? ~(uint64_t) 0 : 0)) & mask))
+			word->overflow = 1;
 	}
 }
 
 // --------------------------------------------------
 // word_op_add
 // --------------------------------------------------
+//   adds (sign = +1) or subtracts (sign = -1) the value
+//   of "added_value", shifted to the left by "position"
+//   bits, to/from the value stored in "result".
+//
+// notes:
+// - both operands are sign-extended according to their
+//   own types, and the sum is formed a whole limb at a
+//   time through a carry (or borrow) chain.
+// - bits of "result" below "position" are unaffected.
+// - the chain is carried one limb beyond both operands,
+//   which is enough to hold the exact sum, and the over-
+//   flow flag is set if the bits of that sum which lie
+//   beyond the width of "result" are not a mere exten-
+//   sion of it (a sign extension for a signed result,
+//   and zeros for an unsigned one). in any case, "result"
+//   receives the least-significant bits of the sum.
+// --------------------------------------------------
 void word_op_add(struct word_header* result, 
 				 struct word_header* added_value,
 				 char sign, unsigned short position) {
 	
-	assert(NULL != result && result->length > 0 && NULL != added_value && added_value->length > 0);
-	if (NULL == result || 0 == result->length || NULL == added_value || 0 == added_value->length) {
-		perror("Invalid word was passed to word_op_add.");
-		return ;
-	}
+	WORD_VALIDATE(NULL != result && result->length > 0 && NULL != added_value && added_value->length > 0, 
+				  "Invalid word was passed to word_op_add.");
 	
-	assert(1 == sign || -1 == sign);
-	if (sign != 1 && sign != -1) {
-		perror("Inavlid value passed to sign of word_op_add.");
-		return ;
+	WORD_VALIDATE(1 == sign || -1 == sign, "Inavlid value passed to sign of word_op_add.");
+	
+	const unsigned int result_limbs = LIMB_COUNT(result->length),
+	                   added_limbs = LIMB_COUNT((unsigned int) position + added_value->length);
+	const unsigned int limb_count = 
+		(result_limbs > added_limbs ? result_limbs : added_limbs) + 1;
+	
+	// the number of bits of the result word stored in its
+	// most-significant limb, and the mask that covers them.
+	const unsigned int top_bits = result->length - (result_limbs - 1) * LIMB_BITS;
+	const uint64_t top_mask = (LIMB_BITS == top_bits ? 
+							   ~(uint64_t) 0 : ((uint64_t) 1 << top_bits) - 1);
+	
+	// the bits of the sum beyond the width of the result
+	// (or, for a signed result, starting from its sign bit)
+	// should all be equal to "extension", otherwise the sum
+	// doesn't fit in the result.
+	const uint64_t result_fill = word_signfill(result);
+	const uint64_t check_mask = (result->is_signed ? ~(top_mask >> 1) : ~top_mask);
+	uint64_t extension = result_fill;
+	
+	// "carry" serves as the borrow in case of a subtraction
+	unsigned char carry = 0;
+	
+	// limbs entirely below "position" are left untouched.
+	for (unsigned int k = position / LIMB_BITS; k < limb_count; ++k) {
+		
+		uint64_t source = result_fill;
+		if (k < result_limbs - 1)
+			source = LIMBS(result)[k];
+		else if (k == result_limbs - 1)
+			source = LIMBS(result)[k] | (result_fill & ~top_mask);
+		
+		const uint64_t added_bits = 
+			word_readlimb(added_value, (int) (k * LIMB_BITS) - position);
+		
+		const uint64_t sum = (+1 == sign ? 
+							  limb_addcarry(source, added_bits, &carry) : 
+							  limb_subborrow(source, added_bits, &carry));
+		
+		if (k < result_limbs - 1) {
+			LIMBS(result)[k] = sum;
+		} else if (k == result_limbs - 1) {
+			LIMBS(result)[k] = sum & top_mask;
+			
+			// the sign of the sum as seen within the result
+			extension = 0;
+			if (result->is_signed && ((sum >> (top_bits - 1)) & 1))
+				extension = ~(uint64_t) 0;
+			
+			if (0 != ((sum ^ extension) & check_mask))
+				result->overflow = 1;
+		} else if (sum != extension) {
+			result->overflow = 1;
+		}
 	}
 	
-	unsigned char result_sign = 0, added_value_sign = 0;
-	if (result->is_signed && BITS(result)[result->length - 1])
-		result_sign = 1;
-	if (added_value->is_signed && BITS(added_value)[added_value->length - 1])
-		added_value_sign = 1;	
+	return ;
+}
+
+// --------------------------------------------------
+// word_term_readlimb
+// --------------------------------------------------
+//   returns the limb "k" of the product of the word of
+//   "term" by the magnitude of its digit, shifted to the
+//   left by the offset of the term and sign-extended, 
+//   with the limbs of the product being read in turn
+//   (k = 0, 1, 2...).
+//
+// notes:
+// - "product_carry" and "previous_product" hold the carry
+//   limb of the product and its previous limb between the
+//   calls, and must both start at zero.
+// - the sign of the term (and of its digit) is left to
+//   the caller.
+// --------------------------------------------------
+uint64_t word_term_readlimb(const struct word_term* term, unsigned int k,
+							uint64_t* product_carry, uint64_t* previous_product) {
+	
+	if (1 == term->digit)
+		return word_readlimb(term->word, (int) (k * LIMB_BITS) - term->offset);
+	
+	// the limb of the product lying at the limb "k" of the
+	// result, and the one below it.
+	const unsigned int term_limb_shift = term->offset / LIMB_BITS,
+	                   term_bit_shift = term->offset % LIMB_BITS;
+	if (k < term_limb_shift)
+		return 0;
+	
+	const uint64_t magnitude = 
+		(term->digit < 0 ? -(int64_t) term->digit : term->digit);
+	uint64_t high = 0;
+	uint64_t product = limb_multiply(
+		word_readlimb(term->word, (int) ((k - term_limb_shift) * LIMB_BITS)),
+		magnitude, &high);
+	unsigned char carry = 0;
+	product = limb_addcarry(product, *product_carry, &carry);
+	*product_carry = high + carry;
+	
+	uint64_t bits = product << term_bit_shift;
+	if (0 != term_bit_shift)
+		bits |= *previous_product >> (LIMB_BITS - term_bit_shift);
+	*previous_product = product;
+	
+	return bits;
+}
+
+// --------------------------------------------------
+// word_op_shift_accumulate
+// --------------------------------------------------
+//   shifts "result" to the left by "shift" bits and adds
+//   to it the "term_count" terms in "terms", each multiplied
+//   by its digit, shifted by its own offset and added or
+//   subtracted according to its sign, all in a single pass
+//   over the limbs:
+//
+//   result = result × 2^shift + Σ sign × digit × word × 2^offset
+//
+// notes:
+// - this fuses a "word_op_leftshift" of "result" with a 
+//   "word_op_multiply_digit" and a "word_op_add" per term,
+//   without the need to form or shift the products before-
+//   hand, and gives the same result whenever none of those
+//   operations overflows.
+// - the product of a term is formed a limb at a time, by
+//   multiplying the sign-extended limbs of its word by the
+//   magnitude of the digit (the sign of the digit just
+//   flips the sign of the term).
+// - the sum is formed exactly, with a carry (or borrow) 
+//   chain per term, and the overflow flag is set only if
+//   the final sum doesn't fit in "result" (intermediate
+//   values are not checked, much like in an adder tree),
+//   in which case "result" receives its least-significant
+//   bits.
+// - the terms are sign-extended according to their own
+//   types, and none of them may be "result" itself.
+// --------------------------------------------------
+void word_op_shift_accumulate(struct word_header* result, unsigned short shift,
+							  const struct word_term* terms, unsigned int term_count) {
+	
+	WORD_VALIDATE(NULL != result && result->length > 0, 
+				  "Invalid result word was passed to word_op_shift_accumulate.");
 	
-	int sum = 0;
+	WORD_VALIDATE(NULL != terms || 0 == term_count, 
+				  "Invalid terms were passed to word_op_shift_accumulate.");
 	
-	for (unsigned int i = 0, j = position; 
-		 i < added_value->length || sum != 0; ++i, ++j) {
+	// the number of limbs spanned by the shifted result and
+	// the shifted terms, plus one to hold the exact sum.
+	const unsigned int result_limbs = LIMB_COUNT(result->length);
+	unsigned int limb_count = LIMB_COUNT((unsigned int) shift + result->length);
+	for (unsigned int t = 0; t < term_count; ++t) {
 		
-		if (i >= added_value->length && j >= result->length && (sum == 0 || sum == ~0))
-			break;
+		WORD_VALIDATE(NULL != terms[t].word && terms[t].word->length > 0 && terms[t].word != result, 
+					  "Invalid term word was passed to word_op_shift_accumulate.");
+		WORD_VALIDATE(1 == terms[t].sign || -1 == terms[t].sign, 
+					  "Invalid term sign was passed to word_op_shift_accumulate.");
 		
-		unsigned char source = result_sign, added_bit = added_value_sign;
-		if (j < result->length)
-			source = BITS(result)[j];
-		if (i < added_value->length)
-			added_bit = BITS(added_value)[i];
+		// a product takes at most one limb more than its word.
+		const unsigned int term_limbs = 
+			LIMB_COUNT((unsigned int) terms[t].offset + terms[t].word->length) + 
+			(1 == terms[t].digit ? 0 : 1);
+		if (term_limbs > limb_count)
+			limb_count = term_limbs;
+	}
+	if (result_limbs > limb_count)
+		limb_count = result_limbs;
+	++limb_count;
+	
+	// the number of bits of the result word stored in its
+	// most-significant limb, and the mask that covers them.
+	const unsigned int top_bits = result->length - (result_limbs - 1) * LIMB_BITS;
+	const uint64_t top_mask = (LIMB_BITS == top_bits ? 
+							   ~(uint64_t) 0 : ((uint64_t) 1 << top_bits) - 1);
+	
+	// see "word_op_add".
+	const uint64_t result_fill = word_signfill(result);
+	const uint64_t check_mask = (result->is_signed ? ~(top_mask >> 1) : ~top_mask);
+	uint64_t extension = result_fill;
+	
+	// the result is overwritten while it is being read, so
+	// the original limbs that the shift still needs are
+	// kept in a ring of "limb_shift + 2" limbs.
+	const unsigned int limb_shift = shift / LIMB_BITS, 
+	                   bit_shift = shift % LIMB_BITS,
+	                   ring_size = limb_shift + 2;
+	uint64_t ring[ring_size];
+	
+	// one carry (or borrow) per term, the chain of the term
+	// "t" is held in carries[t].
+	unsigned char carries[term_count + 1];
+	memset(carries, 0, sizeof(carries));
+	
+	// for a term with a digit other than one, the carry limb
+	// of its product and the previous limb of that product,
+	// which is needed to shift it into place.
+	uint64_t product_carries[term_count + 1], previous_products[term_count + 1];
+	memset(product_carries, 0, sizeof(product_carries));
+	memset(previous_products, 0, sizeof(previous_products));
+	
+	for (unsigned int k = 0; k < limb_count; ++k) {
 		
-		if (+1 == sign)
-			sum += source + added_bit;
-		if (-1 == sign)
-			sum += source - added_bit;
+		// the limb "k" of the result, sign-extended.
+		uint64_t original = result_fill;
+		if (k < result_limbs - 1)
+			original = LIMBS(result)[k];
+		else if (k == result_limbs - 1)
+			original = LIMBS(result)[k] | (result_fill & ~top_mask);
+		ring[k % ring_size] = original;
 		
-		if (j < result->length)
-			BITS(result)[j] = sum & 1;
+		// the limb "k" of the shifted result, which is made up
+		// of the original limbs "k - limb_shift" and the one
+		// below it.
+		uint64_t sum = 0;
+		if (k >= limb_shift) {
+			sum = ring[(k - limb_shift) % ring_size] << bit_shift;
+			if (0 != bit_shift && k > limb_shift)
+				sum |= ring[(k - limb_shift - 1) % ring_size] >> (LIMB_BITS - bit_shift);
+		}
 		
-		sum >>= 1;
+		for (unsigned int t = 0; t < term_count; ++t) {
+			const struct word_term* term = &terms[t];
+			
+			// a term is subtracted if its sign and the sign of
+			// its digit differ.
+			const char sign = (term->digit < 0 ? -term->sign : term->sign);
+			const uint64_t added_bits = 
+				word_term_readlimb(term, k, &product_carries[t], &previous_products[t]);
+			
+			sum = (+1 == sign ? 
+				   limb_addcarry(sum, added_bits, &carries[t]) : 
+				   limb_subborrow(sum, added_bits, &carries[t]));
+		}
 		
-		if (j >= result->length - 1 && sum != 0 && sum != ~0 && 
-			(!result_sign || sum != 1 << ((result->length - 1) - j))) {
+		if (k < result_limbs - 1) {
+			LIMBS(result)[k] = sum;
+		} else if (k == result_limbs - 1) {
+			LIMBS(result)[k] = sum & top_mask;
 			
+			// the sign of the sum as seen within the result
+			extension = 0;
+			if (result->is_signed && ((sum >> (top_bits - 1)) & 1))
+				extension = ~(uint64_t) 0;
+			
+			if (0 != ((sum ^ extension) & check_mask))
+				result->overflow = 1;
+		} else if (sum != extension) {
 			result->overflow = 1;
-			return ;
 		}
 	}
 	
 	return ;
 }
 
+// --------------------------------------------------
+// word_op_mac
+// --------------------------------------------------
+//   multiplies "source" by the (signed) integer "digit" 
+//   and adds (sign = +1) or subtracts (sign = -1) the
+//   product, shifted to the left by "bit_offset" bits, 
+//   to/from "accumulator":
+//
+//     accumulator = accumulator + sign × digit × source × 2^bit_offset
+//
+// notes:
+// - the product is formed a limb at a time on its way 
+//   into the accumulator, hence neither a temporary for
+//   the product nor a shift of it is needed.
+// - the result and the overflow flag are the same as 
+//   with "word_op_add" on the shifted product, and bits
+//   of "accumulator" below "bit_offset" are unaffected.
+// - "source" can't be "accumulator" itself.
+// --------------------------------------------------
+void word_op_mac(struct word_header* accumulator, int digit,
+				 struct word_header* source, unsigned short bit_offset, char sign) {
+	
+	const struct word_term term = {source, sign, bit_offset, digit};
+	word_op_shift_accumulate(accumulator, 0, &term, 1);
+}
+
+// --------------------------------------------------
+// word_op_carrysave_accumulate
+// --------------------------------------------------
+//   the carry-save counterpart of "word_op_shift_accumulate",
+//   shifts the carry-save word "word" to the left by "shift"
+//   bits and adds to it the "term_count" terms in "terms",
+//   each through a row of full adders (a 3:2 compressor) of
+//   its own:
+//
+//   sum + carry = (sum + carry) × 2^shift + Σ sign × digit × word × 2^offset
+//
+// notes:
+// - no carry travels more than one bit position, the carry
+//   word just receives the majority of the three inputs of
+//   every full adder, shifted by one bit, as a row of full
+//   adders in hardware would.
+// - a subtracted term is inverted on its way into the full
+//   adders, and the one that completes its negation takes
+//   the least-significant bit of the carry word, which the
+//   shift of the majority bits leaves free.
+// - the arithmetic is modulo 2^length, as there is no way
+//   to tell an overflow apart without resolving the carries,
+//   so the integrity flags of the sum and carry words are
+//   left untouched.
+// - none of the terms may be the sum or the carry word.
+// --------------------------------------------------
+void word_op_carrysave_accumulate(struct carrysave_word* word, unsigned short shift,
+								  const struct word_term* terms, unsigned int term_count) {
+	
+	WORD_VALIDATE(NULL != word && NULL != word->sum && NULL != word->carry &&
+				  word->sum->length > 0 && word->sum->length == word->carry->length, 
+				  "Invalid carry-save word was passed to word_op_carrysave_accumulate.");
+	
+	WORD_VALIDATE(NULL != terms || 0 == term_count, 
+				  "Invalid terms were passed to word_op_carrysave_accumulate.");
+	
+	for (unsigned int t = 0; t < term_count; ++t) {
+		WORD_VALIDATE(NULL != terms[t].word && terms[t].word->length > 0 && 
+					  terms[t].word != word->sum && terms[t].word != word->carry, 
+					  "Invalid term word was passed to word_op_carrysave_accumulate.");
+		WORD_VALIDATE(1 == terms[t].sign || -1 == terms[t].sign, 
+					  "Invalid term sign was passed to word_op_carrysave_accumulate.");
+	}
+	
+	uint64_t* const sum_limbs = LIMBS(word->sum);
+	uint64_t* const carry_limbs = LIMBS(word->carry);
+	const unsigned int limb_count = LIMB_COUNT(word->sum->length);
+	const unsigned int top_bits = word->sum->length - (limb_count - 1) * LIMB_BITS;
+	const uint64_t top_mask = (LIMB_BITS == top_bits ? 
+							   ~(uint64_t) 0 : ((uint64_t) 1 << top_bits) - 1);
+	
+	// see "word_op_shift_accumulate", one ring per word.
+	const unsigned int limb_shift = shift / LIMB_BITS, 
+	                   bit_shift = shift % LIMB_BITS,
+	                   ring_size = limb_shift + 2;
+	uint64_t sum_ring[ring_size], carry_ring[ring_size];
+	
+	// the majority bit shifted out of the previous limb by
+	// the row of full adders of each term, which starts as
+	// the one that completes the negation of the term.
+	unsigned char majority_bits[term_count + 1];
+	
+	// see "word_op_shift_accumulate".
+	uint64_t product_carries[term_count + 1], previous_products[term_count + 1];
+	memset(product_carries, 0, sizeof(product_carries));
+	memset(previous_products, 0, sizeof(previous_products));
+	
+	for (unsigned int t = 0; t < term_count; ++t) {
+		const char sign = (terms[t].digit < 0 ? -terms[t].sign : terms[t].sign);
+		majority_bits[t] = (-1 == sign);
+	}
+	
+	for (unsigned int k = 0; k < limb_count; ++k) {
+		
+		sum_ring[k % ring_size] = sum_limbs[k];
+		carry_ring[k % ring_size] = carry_limbs[k];
+		
+		// the limb "k" of the shifted sum and carry words (the
+		// bits shifted in are zeros).
+		uint64_t sum = 0, carry = 0;
+		if (k >= limb_shift) {
+			sum = sum_ring[(k - limb_shift) % ring_size] << bit_shift;
+			carry = carry_ring[(k - limb_shift) % ring_size] << bit_shift;
+			if (0 != bit_shift && k > limb_shift) {
+				sum |= sum_ring[(k - limb_shift - 1) % ring_size] >> (LIMB_BITS - bit_shift);
+				carry |= carry_ring[(k - limb_shift - 1) % ring_size] >> (LIMB_BITS - bit_shift);
+			}
+		}
+		
+		for (unsigned int t = 0; t < term_count; ++t) {
+			const struct word_term* term = &terms[t];
+			const char sign = (term->digit < 0 ? -term->sign : term->sign);
+			
+			uint64_t added_bits = 
+				word_term_readlimb(term, k, &product_carries[t], &previous_products[t]);
+			if (-1 == sign)
+				added_bits = ~added_bits;
+			
+			// the row of full adders.
+			const uint64_t majority = 
+				(sum & carry) | (sum & added_bits) | (carry & added_bits);
+			sum ^= carry ^ added_bits;
+			carry = (majority << 1) | majority_bits[t];
+			majority_bits[t] = (unsigned char) (majority >> (LIMB_BITS - 1));
+		}
+		
+		if (k == limb_count - 1) {
+			sum &= top_mask;
+			carry &= top_mask;
+		}
+		sum_limbs[k] = sum;
+		carry_limbs[k] = carry;
+	}
+	
+	return ;
+}
+
+// --------------------------------------------------
+// word_op_compress32
+// --------------------------------------------------
+//   adds a single term to the carry-save word "word", 
+//   through a 3:2 compressor (see "word_op_carrysave_
+//   accumulate").
+// --------------------------------------------------
+void word_op_compress32(struct carrysave_word* word, const struct word_term* term) {
+	
+	word_op_carrysave_accumulate(word, 0, term, 1);
+}
+
+// --------------------------------------------------
+// word_op_compress42
+// --------------------------------------------------
+//   adds the two terms in "terms" to the carry-save word
+//   "word", through a 4:2 compressor made up of two rows
+//   of full adders (see "word_op_carrysave_accumulate").
+// --------------------------------------------------
+void word_op_compress42(struct carrysave_word* word, const struct word_term terms[2]) {
+	
+	word_op_carrysave_accumulate(word, 0, terms, 2);
+}
+
+// --------------------------------------------------
+// word_carrysave_estimate
+// --------------------------------------------------
+//   estimates the "count" bits of the value of the carry-
+//   save word "word" starting at the bit "position" (see
+//   "word_extract_bits"), by adding the same bits of the
+//   sum and carry words with a carry-propagate adder only
+//   "count" bits wide.
+//
+// notes:
+// - the carry that the bits below "position" would send 
+//   into the field is ignored, so the estimate is either 
+//   exact or one unit (of the field) too low.
+// - the field must lie within the word, and the estimate
+//   is sign-extended if "sign_extend" is set.
+// --------------------------------------------------
+int64_t word_carrysave_estimate(struct carrysave_word* word, int position, 
+								unsigned char count, unsigned char sign_extend) {
+	
+	WORD_VALIDATE(NULL != word && NULL != word->sum && NULL != word->carry, 
+				  "Invalid carry-save word was passed to word_carrysave_estimate.", 0);
+	
+	WORD_VALIDATE(count > 0 && count <= LIMB_BITS && position >= 0 &&
+				  position + count <= word->sum->length,
+				  "Invalid field was passed to word_carrysave_estimate.", 0);
+	
+	uint64_t field = 
+		(uint64_t) word_extract_bits(word->sum, position, count, 0) + 
+		(uint64_t) word_extract_bits(word->carry, position, count, 0);
+	
+	if (count < LIMB_BITS) {
+		field &= ((uint64_t) 1 << count) - 1;
+		if (sign_extend && ((field >> (count - 1)) & 1))
+			field |= ~(uint64_t) 0 << count;
+	}
+	
+	return (int64_t) field;
+}
+
+// --------------------------------------------------
+// word_carrysave_resolve
+// --------------------------------------------------
+//   stores the value of the carry-save word "word" in 
+//   "result", a word of the same length, by adding its
+//   sum and carry words with a carry-propagate adder.
+//
+// notes:
+// - the sign and the integrity flags of "result" are left
+//   untouched (see "word_op_carrysave_accumulate").
+// --------------------------------------------------
+void word_carrysave_resolve(struct word_header* result, struct carrysave_word* word) {
+	
+	WORD_VALIDATE(NULL != word && NULL != word->sum && NULL != word->carry, 
+				  "Invalid carry-save word was passed to word_carrysave_resolve.");
+	
+	WORD_VALIDATE(NULL != result && result->length == word->sum->length,
+				  "Invalid result word was passed to word_carrysave_resolve.");
+	
+	const unsigned int limb_count = LIMB_COUNT(result->length);
+	unsigned char carry = 0;
+	for (unsigned int k = 0; k < limb_count; ++k)
+		LIMBS(result)[k] = limb_addcarry(LIMBS(word->sum)[k], LIMBS(word->carry)[k], &carry);
+	
+	word_clearpadding(result);
+}
+
 // --------------------------------------------------
 // word_op_multiply
 // --------------------------------------------------
+//   stores the product of "multiplier" and "multiplicand"
+//   in "result", which may be one of the operands.
+//
+// notes:
+// - the product of the magnitudes is formed on whole
+//   limbs and then negated if the operands differ in
+//   sign, which requires a signed result word.
+// - an overflow occurs if the magnitude of the product
+//   doesn't fit in the result (excluding its sign bit
+//   in the case of a signed result), in which case the
+//   result receives the least-significant bits.
+// --------------------------------------------------
 void word_op_multiply(struct word_header* result, 
 					  struct word_header* multiplier, 
 					  struct word_header* multiplicand) {
 	
-	assert(NULL != result && result->length > 0);
-	if (NULL == result || 0 == result->length) {
-		perror("Invalid result pointer was passed to word_op_multiply.");
-		return ;
+	WORD_VALIDATE(NULL != result && result->length > 0, 
+				  "Invalid result pointer was passed to word_op_multiply.");
+	WORD_VALIDATE(NULL != multiplier && multiplier->length > 0, 
+				  "Invalid multiplier pointer was passed to word_op_multiply.");
+	WORD_VALIDATE(NULL != multiplicand && multiplicand->length > 0, 
+				  "Invalid multiplicand pointer was passed to word_op_multiply.");	
+	
+	const unsigned char sign1 = (0 != word_signfill(multiplier) ? 1 : 0),
+	                    sign2 = (0 != word_signfill(multiplicand) ? 1 : 0);
+	
+	WORD_VALIDATE(sign1 == sign2 || result->is_signed, 
+				  "word_op_multiply cannot store a negative result in an unsigned result word.");
+	const unsigned int na = LIMB_COUNT(multiplier->length),
+	                   nb = LIMB_COUNT(multiplicand->length),
+	                   nr = LIMB_COUNT(result->length);
+	
+	// the product is formed in a buffer of its own, which
+	// provides security against the case when the result
+	// is stored into one of the operands, which is a common
+	// scenario (A = A * B).
+	
+	// a non-negative operand is its own magnitude, while the
+	// magnitude of a negative one is formed on the stack.
+	uint64_t magnitude1[sign1 ? na : 1], magnitude2[sign2 ? nb : 1];
+	const uint64_t *a = LIMBS(multiplier), *b = LIMBS(multiplicand);
+	if (sign1) {
+		word_magnitude(magnitude1, multiplier);
+		a = magnitude1;
 	}
-	assert(NULL != multiplier && multiplier->length > 0);
-	if (NULL == multiplier || 0 == multiplier->length) {
-		perror("Invalid multiplier pointer was passed to word_op_multiply.");
-		return ;
+	if (sign2) {
+		word_magnitude(magnitude2, multiplicand);
+		b = magnitude2;
 	}
-	assert(NULL != multiplicand && multiplicand->length > 0);
-	if (NULL == multiplicand || 0 == multiplicand->length) {
-		perror("Invalid multiplicand pointer was passed to word_op_multiply.");
-		return ;
-	}	
 	
-	char sign1 = 0, sign2 = 0;
-	if (multiplier->is_signed && BITS(multiplier)[multiplier->length - 1]) 
-		sign1 = 1;
-	if (multiplicand->is_signed && BITS(multiplicand)[multiplicand->length - 1])
-		sign2 = 1;
+	// the full product of the magnitudes.
+	uint64_t product[na + nb];
+	limbs_multiply(product, a, na, b, nb);
 	
-	assert(sign1 == sign2 || result->is_signed);
-	if (sign1 != sign2 && !result->is_signed) {
-		perror("word_op_multiply cannot store a negative result in an unsigned result word.");
-		return ;
+	// any bit of the magnitude at or beyond this position
+	// doesn't fit in the result.
+	const unsigned int width = result->length - (result->is_signed ? 1 : 0);
+	for (unsigned int i = width / LIMB_BITS; i < na + nb; ++i)
+		if (0 != (product[i] & limb_rangemask(i, width, (na + nb) * LIMB_BITS)))
+			result->overflow = 1;
+	
+	// a negative product is sign-extended into the limbs of
+	// the result beyond the product, if any.
+	uint64_t extension = 0;
+	if (sign1 != sign2) {
+		for (unsigned int i = 0; i < na + nb; ++i)
+			if (0 != product[i]) {
+				extension = ~(uint64_t) 0;
+				break;
+			}
+		
+		limbs_negate(product, na + nb);
 	}
-	const unsigned short na = multiplier->length,
-	                     nb = multiplicand->length;
 	
-	unsigned int sum = 0;
+	for (unsigned int i = 0; i < nr; ++i)
+		LIMBS(result)[i] = (i < na + nb ? product[i] : extension);
+	
+	word_clearpadding(result);
+	
+	return ;
+}
+
+// --------------------------------------------------
+// word_op_multiply_digit
+// --------------------------------------------------
+//   stores the product of the (signed) integer "digit"
+//   and "word" in "result", which may be "word" itself.
+//
+// notes:
+// - this is the counterpart of "word_op_multiply" for 
+//   the common case where one of the operands is a high-
+//   radix digit, it gives the same result and overflow 
+//   flag as passing that digit in a word of its own.
+// - the magnitude of "word" is formed on the fly while
+//   reading its limbs, and multiplied by the magnitude 
+//   of the digit in one pass, which is negated on the
+//   fly as well when the signs differ, hence no memory
+//   is allocated.
+// --------------------------------------------------
+void word_op_multiply_digit(struct word_header* result, 
+							int digit,
+							struct word_header* word) {
 	
-	// copying operands provides security against the case
-	// when the result is stored into one of the operands,
-	// which is a common scenario (A = A * B).
+	WORD_VALIDATE(NULL != result && result->length > 0, 
+				  "Invalid result pointer was passed to word_op_multiply_digit.");
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word pointer was passed to word_op_multiply_digit.");
 	
-	// copying operands is provided in a single step along
-	// with finding the absolute value (in case we're dealing
-	// with signed operands).
-	struct word_header *multiplier_copy = word_op_abs(multiplier),
-	                   *multiplicand_copy = word_op_abs(multiplicand);
+	const unsigned char sign1 = (digit < 0 ? 1 : 0),
+	                    sign2 = (0 != word_signfill(word) ? 1 : 0);
 	
-	for (unsigned int i = 0; i < (na + nb - 1) || sum != 0; ++i) {
-		
-		unsigned short alpha = (i < nb ? 0 : i - nb + 1);
-		unsigned short beta  = (i < nb ? i : nb - 1);
-		
-		unsigned int no_of_bits = 0;
-		if (i < nb && i < na) 
-			no_of_bits = i + 1;
-		if (i < nb && i >= na) 
-			no_of_bits = na;
-		if (i >= nb && i < na) 
-			no_of_bits = nb;
-		if (i >= nb && i >= na && i < (na + nb - 1))
-			no_of_bits = (na + nb - 1) - i;
+	WORD_VALIDATE(sign1 == sign2 || result->is_signed, 
+				  "word_op_multiply_digit cannot store a negative result in an unsigned result word.");
+	
+	const uint64_t magnitude = (digit < 0 ? -(int64_t) digit : digit);
+	const unsigned int nw = LIMB_COUNT(word->length),
+	                   nr = LIMB_COUNT(result->length);
+	const unsigned int limb_count = (nr > nw + 1 ? nr : nw + 1);
+	
+	// the mask of the bits of "word" in its top limb, which
+	// is needed when negating that limb.
+	const uint64_t top_mask = limb_rangemask(nw - 1, 0, word->length);
+	
+	// any bit of the magnitude at or beyond this position
+	// doesn't fit in the result.
+	const unsigned int width = result->length - (result->is_signed ? 1 : 0);
+	
+	// "word_carry" negates the word while reading it, the 
+	// product carry is one limb wide, and "result_carry" 
+	// negates the product while writing it.
+	unsigned char word_carry = 1, result_carry = 1;
+	uint64_t product_carry = 0;
+	
+	for (unsigned int k = 0; k < limb_count; ++k) {
 		
-		for (unsigned int j = 0; j < no_of_bits; ++j, ++alpha, --beta)
-			sum += (BITS(multiplier_copy)[alpha] ? BITS(multiplicand_copy)[beta] : 0);
+		uint64_t source = 0;
+		if (k < nw) {
+			source = LIMBS(word)[k];
+			if (sign2) {
+				source = limb_addcarry(~source, 0, &word_carry);
+				if (k == nw - 1)
+					source &= top_mask;
+			}
+		}
 		
-		if (result->is_signed && i >= result->length - 1 && sum != 0)
-			result->overflow = 1;
+		uint64_t high = 0;
+		uint64_t product = limb_multiply(source, magnitude, &high);
+		unsigned char carry = 0;
+		product = limb_addcarry(product, product_carry, &carry);
+		product_carry = high + carry;
 		
-		if (i >= result->length && sum != 0) {
+		if (0 != (product & limb_rangemask(k, width, limb_count * LIMB_BITS)))
 			result->overflow = 1;
-			break;
-		}
 		
-		if (i < result->length)
-			BITS(result)[i] = sum & 1;
+		if (sign1 != sign2)
+			product = limb_addcarry(~product, 0, &result_carry);
 		
-		sum >>= 1;
+		if (k < nr)
+			LIMBS(result)[k] = product;
 	}
 	
-	free(multiplier_copy);
-	free(multiplicand_copy);
-	
-	if (sign1 != sign2)
-		word_op_negate(result);
-	
-	return ;
+	word_clearpadding(result);
 }
 
 // --------------------------------------------------
@@ -1096,107 +3036,185 @@ void word_op_multiply(struct word_header* result,
 // --------------------------------------------------
 void word_op_normalize(struct word_header* word, unsigned short change_size) {
 	
-	assert(NULL != word && word->length > 0);
-	if (NULL == word || 0 == word->length) {
-		perror("Invalid word was passed to word_op_normalize.");
-		return ;
-	}
+	WORD_VALIDATE(NULL != word && word->length > 0, 
+				  "Invalid word was passed to word_op_normalize.");
 	
 	int i = word->length - 1;
 	for (; i >= 0; --i)
-		if (BITS(word)[i] != 0) break;
+		if (word_getbit(word, i) != 0) break;
 	
 	// A zero word doesn't need normalization
 	if (-1 == i) return ;
 	
 	if (0 != change_size) {
-		const size_t new_size = sizeof(struct word_header) + sizeof(unsigned char) * i;
-		realloc(word, new_size);
-		
-		word->length = (unsigned short) i;
+		// the word only shrinks, hence it keeps its place (and
+		// its storage) whatever its kind, while the limbs beyond
+		// its new length are left unused.
+		// ("i" is the index of the top set bit, which is kept)
+		word->length = (unsigned short) (i + 1);
+		word_clearpadding(word);
 	} else {
 		for (int j = word->length - 1; j >= 0; --j)
-			BITS(word)[j] = (i >= 0 ? BITS(word)[i--] : 0);
+			word_setbit(word, j, (i >= 0 ? word_getbit(word, i--) : 0));
 	}
 }
 
 // --------------------------------------------------
-// word_op_isqrt
+// word_op_isqrtrem
 // --------------------------------------------------
+//   stores the integer square root of "radicand" (the
+//   floor of its square root) in "root", and the rem-
+//   ainder "radicand - root^2" in "remainder", which 
+//   may be NULL.
 //
-// ADAPTED FROM WIKIPEDIA's ALGORITHM:
-//
-// short isqrt(short num) {
-//
-//  	short result = 0;
-//  	short bit = 1 << 14; // The second-to-top bit is set: 1L<<30 for long
-//
-//  	// "bit" starts at the highest power of four <= the argument.
-//  	while (bit > num)
-//  		bit >>= 2;
-//
-//  	while (bit != 0) {
-//  		if (num >= result + bit) {
-//				num -= result + bit;
-//				result = (result >> 1) + bit;
-//			}
-//			else
-//				result >>= 1;
-//
-//			bit >>= 2;
-//		}
-//
-//		return result;
-// }
-//
-struct word_header* word_op_isqrt(struct word_header* radicand) {
+// notes:
+// - the root is found through Newton's iteration on the
+//   limbs, x = (x + radicand / x) / 2, starting from a
+//   power of two no less than the root, and stopping as
+//   soon as x no longer decreases.
+// - a negative radicand has a root of zero (and hence a 
+//   remainder equal to itself).
+// - the overflow flag of "root" or "remainder" is set if
+//   it is too narrow for its value, in which case it 
+//   receives the least-significant bits.
+// - everything is worked out on the stack, hence no 
+//   memory is allocated.
+// --------------------------------------------------
+void word_op_isqrtrem(struct word_header* root, struct word_header* remainder,
+					  struct word_header* radicand) {
 	
-	assert(NULL != radicand && radicand->length > 0);
-	if (NULL == radicand || 0 == radicand->length) {
-		perror("Invalid word was passed to word_op_isqrt.");
-		return NULL;
-	}
+	WORD_VALIDATE(NULL != radicand && radicand->length > 0, 
+				  "Invalid radicand was passed to word_op_isqrtrem.");
+	WORD_VALIDATE(NULL != root && root->length > 0 && root != radicand, 
+				  "Invalid root was passed to word_op_isqrtrem.");
+	WORD_VALIDATE(NULL == remainder || (remainder->length > 0 && remainder != root), 
+				  "Invalid remainder was passed to word_op_isqrtrem.");
 	
-	struct word_header *bit = create_word(radicand->length),
-	*result = create_word(radicand->length),
-	*remainder = create_word_duplicate(radicand);
+	const unsigned int count = LIMB_COUNT(radicand->length);
+	const unsigned char negative = (0 != word_signfill(radicand) ? 1 : 0);
 	
-	BITS(bit)[~((int)1) & (radicand->length - 1)] = 1;
+	// the radicand, less its most-significant zero limbs, the
+	// root "x", its next estimate "y" and the quotient.
+	uint64_t n[count], x[count + 1], y[count + 1], quotient[count];
+	unsigned int n_count = count;
 	
-	// while (bit > remainder)
-	while (1 == word_op_compare(bit, remainder))
-		word_op_rightshift(bit, 2);
+	memcpy(n, LIMBS(radicand), count * sizeof(uint64_t));
+	while (n_count > 0 && 0 == n[n_count - 1])
+		--n_count;
 	
-	// while (bit != 0)
-	while (0 != word_op_compare_constant(bit, 0)) {
+	memset(x, 0, sizeof(x));
+	memset(y, 0, sizeof(y));
+	
+	if (!negative && n_count > 0) {
 		
-		// update_term = (result + bit);
-		struct word_header* update_term = create_word_duplicate(result);
-		word_op_add(update_term, bit, 1, 0);
+		// the root of a b-bit radicand is below 2^ceil(b/2).
+		const unsigned int bit_count = 
+			n_count * LIMB_BITS - __builtin_clzll(n[n_count - 1]);
+		const unsigned int start = (bit_count + 1) / 2;
+		x[start / LIMB_BITS] = (uint64_t) 1 << (start % LIMB_BITS);
 		
-		// if (remainder >= (result + bit) OR >= (update_term)) {
-		if (word_op_compare(remainder, update_term) >= 0) {
-			// remainder -= (result + bit) OR (update_term);
-			word_op_add(remainder, update_term, -1, 0);
+		while (1) {
 			
-			// result = (result >> 1) + bit;
-			word_op_rightshift(result, 1);
-			word_op_add(result, bit, 1, 0);
-		}
-		else {
-			// result >>= 1;
-			word_op_rightshift(result, 1);
+			// the significant limbs of x.
+			unsigned int x_count = n_count + 1;
+			while (0 == x[x_count - 1])
+				--x_count;
+			
+			// y = (x + n / x) / 2
+			limbs_divide(quotient, NULL, n, n_count, x, x_count);
+			
+			unsigned char carry = 0;
+			for (unsigned int i = 0; i <= n_count; ++i)
+				y[i] = limb_addcarry(x[i], (i < n_count ? quotient[i] : 0), &carry);
+			for (unsigned int i = 0; i <= n_count; ++i)
+				y[i] = (y[i] >> 1) | (i < n_count ? y[i + 1] << (LIMB_BITS - 1) : 0);
+			
+			if (limbs_compare(y, x, n_count + 1) >= 0)
+				break;
+			
+			memcpy(x, y, sizeof(x));
 		}
-		
-		// bit >>= 2;
-		word_op_rightshift(bit, 2);
-		word_deallocate(update_term);
 	}
 	
-	word_deallocate(bit);
-	word_deallocate(remainder);
+	// store the root, checking that it fits.
+	const unsigned int root_count = LIMB_COUNT(root->length);
+	const unsigned int root_width = root->length - (root->is_signed ? 1 : 0);
 	
-	return result;
-}
+	for (unsigned int i = 0; i <= count; ++i) {
+		if (i < root_count)
+			LIMBS(root)[i] = x[i];
+		if (0 != (x[i] & limb_rangemask(i, root_width, (count + 1) * LIMB_BITS)))
+			root->overflow = 1;
+	}
+	for (unsigned int i = count + 1; i < root_count; ++i)
+		LIMBS(root)[i] = 0;
+	word_clearpadding(root);
+	
+	if (NULL == remainder)
+		return ;
+	
+	// the remainder is the radicand less the square of the
+	// root (or the radicand itself if it is negative), and 
+	// it is no wider than the radicand.
+	uint64_t square[2 * (count + 1)];
+	memset(square, 0, sizeof(square));
+	if (n_count > 0 && !negative)
+		limbs_multiply(square, x, (count + 1) / 2 + 1, x, (count + 1) / 2 + 1);
+	
+	uint64_t difference[count];
+	memcpy(difference, LIMBS(radicand), count * sizeof(uint64_t));
+	limbs_subtractfrom(difference, count, square, count);
+	
+	// a negative radicand is loaded as is, sign-extended.
+	const uint64_t fill = word_signfill(radicand);
+	if (negative)
+		difference[count - 1] |= fill & ~limb_rangemask(count - 1, 0, radicand->length);
+	
+	const unsigned int remainder_count = LIMB_COUNT(remainder->length);
+	const unsigned int remainder_width = remainder->length - (remainder->is_signed ? 1 : 0);
+	const uint64_t extension = (remainder->is_signed ? fill : 0);
+	
+	for (unsigned int i = 0; i < remainder_count || i < count; ++i) {
+		const uint64_t limb = (i < count ? difference[i] : fill);
+		if (i < remainder_count)
+			LIMBS(remainder)[i] = limb;
+		if (0 != ((limb ^ extension) & limb_rangemask(i, remainder_width, 
+				(remainder_count > count ? remainder_count : count) * LIMB_BITS)))
+			remainder->overflow = 1;
+	}
+
+	// an unsigned remainder can't hold a negative radicand,
+	// whose bits may all fit (its sign fill then lies beyond
+	// the range checked above).
+	if (negative && !remainder->is_signed)
+		remainder->overflow = 1;
 
+	word_clearpadding(remainder);
+}
 
+// --------------------------------------------------
+// word_op_isqrt
+// --------------------------------------------------
+//   returns the integer square root of "radicand" (the
+//   floor of its square root) in a new unsigned word of
+//   the same length, see "word_op_isqrtrem".
+//
+// warning:
+// - the word returned by this function call is
+//   dynamically allocated using "create_word" and
+//   hence should be freed manually using "word_deall
+//   -ocate" to avoid memory leaks.
+// --------------------------------------------------
+struct word_header* word_op_isqrt(struct word_header* radicand) {
+	
+	WORD_VALIDATE(NULL != radicand && radicand->length > 0, 
+				  "Invalid word was passed to word_op_isqrt.", NULL);
+	
+	struct word_header* result = create_word(radicand->length);
+	if (NULL == result)
+		return NULL;
+	
+	word_op_isqrtrem(result, NULL, radicand);
+	
+	return result;
+}